@@ -0,0 +1,71 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <iterator>
+#include <string>
+
+#include "Bench.h"
+#include "Demo.h"
+
+namespace comms_bench
+{
+
+namespace
+{
+
+using Interface = DemoInterface<>;
+using AllMessages = DemoAllMessages<Interface>;
+using DynMemoryStack = demo::Stack<Interface, AllMessages>;
+using InPlaceStack = demo::Stack<Interface, AllMessages, comms::option::app::InPlaceAllocation>;
+
+template <typename TStack>
+void addAllocBenchmark(Registry& registry, const std::string& name)
+{
+    TStack stack;
+    auto frames = demoAllFrames<AllMessages>(stack);
+    registry.add(
+        "alloc", name,
+        [frames](std::size_t iterations) -> std::size_t
+        {
+            TStack readStack;
+            for (std::size_t idx = 0U; idx < iterations; ++idx) {
+                const std::uint8_t* readIter = frames.data();
+                auto remLen = frames.size();
+                while (0U < remLen) {
+                    typename TStack::MsgPtr msgPtr;
+                    auto fromIter = readIter;
+                    auto es = readStack.read(msgPtr, readIter, remLen);
+                    doNotOptimize(msgPtr);
+                    if (es != comms::ErrorStatus::Success) {
+                        break;
+                    }
+                    remLen -= static_cast<std::size_t>(std::distance(fromIter, readIter));
+                }
+            }
+            return frames.size();
+        });
+}
+
+} // namespace
+
+void registerAllocBenchmarks(Registry& registry)
+{
+    addAllocBenchmark<DynMemoryStack>(registry, "DynMemory");
+    addAllocBenchmark<InPlaceStack>(registry, "InPlaceAllocation");
+}
+
+} // namespace comms_bench
@@ -0,0 +1,82 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace comms_bench
+{
+
+/// @brief Prevent the compiler from optimising away the computation
+///     of the provided value.
+template <typename T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r"(&value) : "memory");
+#else
+    static volatile const void* Sink = nullptr;
+    Sink = &value;
+#endif
+}
+
+/// @brief Registry of all the benchmarks.
+class Registry
+{
+public:
+    /// @brief Benchmark function.
+    /// @details Receives number of iterations to perform, returns
+    ///     number of bytes processed by a single iteration.
+    using Func = std::function<std::size_t (std::size_t)>;
+
+    struct Config
+    {
+        std::string filter;
+        std::size_t minTimeMs = 200U;
+        std::size_t repetitions = 5U;
+    };
+
+    void add(const std::string& group, const std::string& name, Func func);
+
+    /// @brief Run benchmarks matching the filter and report results in JSON format.
+    /// @return Number of executed benchmarks
+    std::size_t run(const Config& config, std::ostream& out) const;
+
+private:
+    struct Entry
+    {
+        std::string group;
+        std::string name;
+        Func func;
+    };
+
+    std::vector<Entry> entries_;
+};
+
+void registerFieldBenchmarks(Registry& registry);
+void registerStackBenchmarks(Registry& registry);
+void registerDispatchBenchmarks(Registry& registry);
+void registerAllocBenchmarks(Registry& registry);
+void registerChecksumBenchmarks(Registry& registry);
+
+} // namespace comms_bench
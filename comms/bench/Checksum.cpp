@@ -0,0 +1,67 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "comms/protocol/checksum/BasicSum.h"
+#include "comms/protocol/checksum/Crc.h"
+#include "Bench.h"
+
+namespace comms_bench
+{
+
+namespace
+{
+
+const std::size_t ChecksumDataLen = 4096U;
+
+template <typename TCalc>
+void addChecksum(Registry& registry, const std::string& name)
+{
+    registry.add(
+        "checksum", name,
+        [](std::size_t iterations) -> std::size_t
+        {
+            std::vector<std::uint8_t> data(ChecksumDataLen);
+            for (std::size_t idx = 0U; idx < data.size(); ++idx) {
+                data[idx] = static_cast<std::uint8_t>(idx * 31U);
+            }
+
+            TCalc calc;
+            for (std::size_t idx = 0U; idx < iterations; ++idx) {
+                const std::uint8_t* iter = data.data();
+                auto result = calc(iter, data.size());
+                doNotOptimize(result);
+            }
+            return data.size();
+        });
+}
+
+} // namespace
+
+void registerChecksumBenchmarks(Registry& registry)
+{
+    addChecksum<comms::protocol::checksum::BasicSum<std::uint8_t> >(registry, "BasicSum<u8>");
+    addChecksum<comms::protocol::checksum::BasicSum<std::uint16_t> >(registry, "BasicSum<u16>");
+    addChecksum<comms::protocol::checksum::Crc_CCITT>(registry, "Crc_CCITT");
+    addChecksum<comms::protocol::checksum::Crc_16>(registry, "Crc_16");
+    addChecksum<comms::protocol::checksum::Crc_32>(registry, "Crc_32");
+}
+
+} // namespace comms_bench
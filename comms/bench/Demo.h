@@ -0,0 +1,103 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include "comms/comms.h"
+#include "demo/Message.h"
+#include "demo/Stack.h"
+#include "demo/message/IntValues.h"
+#include "demo/message/EnumValues.h"
+#include "demo/message/BitmaskValues.h"
+#include "demo/message/Bitfields.h"
+#include "demo/message/Strings.h"
+#include "demo/message/Lists.h"
+#include "demo/message/Optionals.h"
+#include "demo/message/FloatValues.h"
+#include "demo/message/Variants.h"
+
+namespace comms_bench
+{
+
+/// @brief Common interface of the demo messages used by the benchmarks.
+template <typename... TExtraOptions>
+using DemoInterface =
+    demo::Message<
+        comms::option::app::ReadIterator<const std::uint8_t*>,
+        comms::option::app::WriteIterator<std::uint8_t*>,
+        comms::option::app::IdInfoInterface,
+        comms::option::app::LengthInfoInterface,
+        TExtraOptions...
+    >;
+
+/// @brief All the demo messages.
+template <typename TMsgBase>
+using DemoAllMessages =
+    std::tuple<
+        demo::message::IntValues<TMsgBase>,
+        demo::message::EnumValues<TMsgBase>,
+        demo::message::BitmaskValues<TMsgBase>,
+        demo::message::Bitfields<TMsgBase>,
+        demo::message::Strings<TMsgBase>,
+        demo::message::Lists<TMsgBase>,
+        demo::message::Optionals<TMsgBase>,
+        demo::message::FloatValues<TMsgBase>,
+        demo::message::Variants<TMsgBase>
+    >;
+
+template <typename TStack>
+class DemoFramesWriter
+{
+public:
+    DemoFramesWriter(const TStack& stack, std::vector<std::uint8_t>& buf)
+      : stack_(stack),
+        buf_(buf)
+    {
+    }
+
+    template <typename TMsg>
+    void operator()()
+    {
+        TMsg msg;
+        auto prevSize = buf_.size();
+        buf_.resize(prevSize + stack_.length(msg));
+        auto writeIter = &buf_[prevSize];
+        auto es = stack_.write(msg, writeIter, buf_.size() - prevSize);
+        static_cast<void>(es);
+        COMMS_ASSERT(es == comms::ErrorStatus::Success);
+    }
+
+private:
+    const TStack& stack_;
+    std::vector<std::uint8_t>& buf_;
+};
+
+/// @brief Serialise default constructed message of every type using provided stack.
+/// @return Concatenated frames of all the messages.
+template <typename TAllMessages, typename TStack>
+std::vector<std::uint8_t> demoAllFrames(const TStack& stack)
+{
+    std::vector<std::uint8_t> result;
+    comms::util::tupleForEachType<TAllMessages>(DemoFramesWriter<TStack>(stack, result));
+    return result;
+}
+
+} // namespace comms_bench
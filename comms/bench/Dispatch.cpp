@@ -0,0 +1,136 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Bench.h"
+#include "Demo.h"
+
+namespace comms_bench
+{
+
+namespace
+{
+
+class Handler;
+using Interface = DemoInterface<comms::option::app::Handler<Handler> >;
+using AllMessages = DemoAllMessages<Interface>;
+using MsgPtr = std::unique_ptr<Interface>;
+
+const std::size_t DispatchRepeatCount = 16U;
+
+class Handler
+{
+public:
+    template <typename TMsg>
+    void handle(TMsg& msg)
+    {
+        count_ += static_cast<std::size_t>(msg.doGetId());
+    }
+
+    void handle(Interface& msg)
+    {
+        count_ += static_cast<std::size_t>(msg.getId());
+    }
+
+    template <typename TMsg>
+    void handleBatch(const comms::MsgDispatchBatch<TMsg>& batch)
+    {
+        for (auto& msg : batch) {
+            handle(msg);
+        }
+    }
+
+    std::size_t count() const
+    {
+        return count_;
+    }
+
+private:
+    std::size_t count_ = 0U;
+};
+
+class MsgsCreator
+{
+public:
+    explicit MsgsCreator(std::vector<MsgPtr>& msgs) : msgs_(msgs) {}
+
+    template <typename TMsg>
+    void operator()()
+    {
+        msgs_.emplace_back(new TMsg);
+    }
+
+private:
+    std::vector<MsgPtr>& msgs_;
+};
+
+std::vector<MsgPtr> createMsgs()
+{
+    std::vector<MsgPtr> msgs;
+    for (auto idx = 0U; idx < DispatchRepeatCount; ++idx) {
+        comms::util::tupleForEachType<AllMessages>(MsgsCreator(msgs));
+    }
+    return msgs;
+}
+
+template <typename TDispatcher>
+void addDispatchBenchmark(Registry& registry, const std::string& name)
+{
+    registry.add(
+        "dispatch", name,
+        [](std::size_t iterations) -> std::size_t
+        {
+            auto msgs = createMsgs();
+            Handler handler;
+            for (std::size_t idx = 0U; idx < iterations; ++idx) {
+                for (auto& msgPtr : msgs) {
+                    TDispatcher::template dispatch<AllMessages>(*msgPtr, handler);
+                }
+            }
+            doNotOptimize(handler.count());
+            return 0U;
+        });
+
+    registry.add(
+        "dispatch", name + "/batch",
+        [](std::size_t iterations) -> std::size_t
+        {
+            auto msgs = createMsgs();
+            Handler handler;
+            comms::MsgDispatchBatchBuffer buf;
+            for (std::size_t idx = 0U; idx < iterations; ++idx) {
+                TDispatcher::template dispatchBatch<AllMessages>(msgs.begin(), msgs.end(), handler, buf);
+            }
+            doNotOptimize(handler.count());
+            return 0U;
+        });
+}
+
+} // namespace
+
+void registerDispatchBenchmarks(Registry& registry)
+{
+    addDispatchBenchmark<comms::MsgDispatcher<> >(registry, "Default");
+    addDispatchBenchmark<comms::MsgDispatcher<comms::option::app::ForceDispatchPolymorphic> >(registry, "Polymorphic");
+    addDispatchBenchmark<comms::MsgDispatcher<comms::option::app::ForceDispatchStaticBinSearch> >(registry, "StaticBinSearch");
+    addDispatchBenchmark<comms::MsgDispatcher<comms::option::app::ForceDispatchLinearSwitch> >(registry, "LinearSwitch");
+}
+
+} // namespace comms_bench
@@ -0,0 +1,193 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "comms/comms.h"
+#include "Bench.h"
+
+namespace comms_bench
+{
+
+namespace
+{
+
+using FieldBase = comms::Field<comms::option::def::BigEndian>;
+
+using U32Field = comms::field::IntValue<FieldBase, std::uint32_t>;
+
+using VarLengthField =
+    comms::field::IntValue<
+        FieldBase,
+        std::uint32_t,
+        comms::option::def::VarLength<1, 5>
+    >;
+
+enum class BenchEnum : std::uint8_t
+{
+    Val1,
+    Val2,
+    Val3,
+    NumOfValues
+};
+
+using EnumField =
+    comms::field::EnumValue<
+        FieldBase,
+        BenchEnum,
+        comms::option::def::ValidNumValueRange<0, static_cast<int>(BenchEnum::NumOfValues) - 1>
+    >;
+
+using BitmaskField =
+    comms::field::BitmaskValue<
+        FieldBase,
+        comms::option::def::FixedLength<2>,
+        comms::option::def::BitmaskReservedBits<0xf000, 0>
+    >;
+
+using FloatField = comms::field::FloatValue<FieldBase, double>;
+
+using StringField =
+    comms::field::String<
+        FieldBase,
+        comms::option::def::SequenceSizeFieldPrefix<comms::field::IntValue<FieldBase, std::uint8_t> >
+    >;
+
+using RawListField =
+    comms::field::ArrayList<
+        FieldBase,
+        std::uint8_t,
+        comms::option::def::SequenceSizeFieldPrefix<comms::field::IntValue<FieldBase, std::uint16_t> >
+    >;
+
+using IntListField =
+    comms::field::ArrayList<
+        FieldBase,
+        comms::field::IntValue<FieldBase, std::uint16_t>,
+        comms::option::def::SequenceSizeFieldPrefix<comms::field::IntValue<FieldBase, std::uint16_t> >
+    >;
+
+using BitfieldField =
+    comms::field::Bitfield<
+        FieldBase,
+        std::tuple<
+            comms::field::IntValue<FieldBase, std::uint8_t, comms::option::def::FixedBitLength<4> >,
+            comms::field::IntValue<FieldBase, std::uint16_t, comms::option::def::FixedBitLength<12> >,
+            comms::field::IntValue<FieldBase, std::uint8_t, comms::option::def::FixedBitLength<8> >
+        >
+    >;
+
+using BundleField =
+    comms::field::Bundle<
+        FieldBase,
+        std::tuple<
+            comms::field::IntValue<FieldBase, std::uint16_t>,
+            EnumField,
+            StringField
+        >
+    >;
+
+using OptionalField =
+    comms::field::Optional<
+        U32Field,
+        comms::option::def::ExistsByDefault
+    >;
+
+template <typename TField>
+void addField(Registry& registry, const std::string& name, const TField& field)
+{
+    std::vector<std::uint8_t> buf(field.length());
+    auto writeIter = &buf[0];
+    auto es = field.write(writeIter, buf.size());
+    static_cast<void>(es);
+    COMMS_ASSERT(es == comms::ErrorStatus::Success);
+
+    registry.add(
+        "field", name + "/read",
+        [buf](std::size_t iterations) -> std::size_t
+        {
+            TField readField;
+            for (std::size_t idx = 0U; idx < iterations; ++idx) {
+                const std::uint8_t* readIter = buf.data();
+                auto readEs = readField.read(readIter, buf.size());
+                doNotOptimize(readEs);
+                doNotOptimize(readField);
+            }
+            return buf.size();
+        });
+
+    registry.add(
+        "field", name + "/write",
+        [field](std::size_t iterations) -> std::size_t
+        {
+            std::vector<std::uint8_t> outBuf(field.length());
+            for (std::size_t idx = 0U; idx < iterations; ++idx) {
+                auto iter = &outBuf[0];
+                auto writeEs = field.write(iter, outBuf.size());
+                doNotOptimize(writeEs);
+                doNotOptimize(outBuf);
+            }
+            return outBuf.size();
+        });
+}
+
+} // namespace
+
+void registerFieldBenchmarks(Registry& registry)
+{
+    addField(registry, "IntValue<u32>", U32Field(0x12345678));
+    addField(registry, "IntValue<VarLength>", VarLengthField(0x0fffffff));
+    addField(registry, "EnumValue", EnumField(BenchEnum::Val2));
+
+    BitmaskField bitmask;
+    bitmask.value() = 0x0a5a;
+    addField(registry, "BitmaskValue", bitmask);
+
+    addField(registry, "FloatValue<double>", FloatField(1.2345));
+    addField(registry, "String", StringField("Hello world, this is a string field"));
+
+    RawListField rawList;
+    rawList.value().assign(256U, 0x5a);
+    addField(registry, "ArrayList<raw,256>", rawList);
+
+    IntListField intList;
+    intList.value().resize(64U);
+    for (auto& elem : intList.value()) {
+        elem.value() = 0x1234;
+    }
+    addField(registry, "ArrayList<IntValue,64>", intList);
+
+    BitfieldField bitfield;
+    std::get<0>(bitfield.value()).value() = 0x5;
+    std::get<1>(bitfield.value()).value() = 0xabc;
+    std::get<2>(bitfield.value()).value() = 0x12;
+    addField(registry, "Bitfield", bitfield);
+
+    BundleField bundle;
+    std::get<0>(bundle.value()).value() = 0x1234;
+    std::get<1>(bundle.value()).value() = BenchEnum::Val3;
+    std::get<2>(bundle.value()).value() = "bundle";
+    addField(registry, "Bundle", bundle);
+
+    OptionalField optional;
+    optional.field().value() = 0xabcdef;
+    addField(registry, "Optional", optional);
+}
+
+} // namespace comms_bench
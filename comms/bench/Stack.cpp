@@ -0,0 +1,125 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <iterator>
+#include <memory>
+#include <string>
+
+#include "Bench.h"
+#include "Demo.h"
+
+namespace comms_bench
+{
+
+namespace
+{
+
+using Interface = DemoInterface<>;
+using AllMessages = DemoAllMessages<Interface>;
+using Stack = demo::Stack<Interface, AllMessages>;
+
+template <typename TMsg>
+std::string msgName()
+{
+    return TMsg::doName();
+}
+
+class MsgBenchRegistrar
+{
+public:
+    explicit MsgBenchRegistrar(Registry& registry) : registry_(registry) {}
+
+    template <typename TMsg>
+    void operator()()
+    {
+        std::vector<std::uint8_t> frame;
+        Stack stack;
+        TMsg msg;
+        frame.resize(stack.length(msg));
+        auto writeIter = &frame[0];
+        auto es = stack.write(msg, writeIter, frame.size());
+        static_cast<void>(es);
+        COMMS_ASSERT(es == comms::ErrorStatus::Success);
+
+        registry_.add(
+            "stack", msgName<TMsg>() + "/read",
+            [frame](std::size_t iterations) -> std::size_t
+            {
+                Stack readStack;
+                for (std::size_t idx = 0U; idx < iterations; ++idx) {
+                    Stack::MsgPtr msgPtr;
+                    const std::uint8_t* readIter = frame.data();
+                    auto readEs = readStack.read(msgPtr, readIter, frame.size());
+                    doNotOptimize(readEs);
+                    doNotOptimize(msgPtr);
+                }
+                return frame.size();
+            });
+
+        registry_.add(
+            "stack", msgName<TMsg>() + "/write",
+            [](std::size_t iterations) -> std::size_t
+            {
+                Stack writeStack;
+                TMsg writeMsg;
+                std::vector<std::uint8_t> buf(writeStack.length(writeMsg));
+                for (std::size_t idx = 0U; idx < iterations; ++idx) {
+                    auto iter = &buf[0];
+                    auto writeEs = writeStack.write(writeMsg, iter, buf.size());
+                    doNotOptimize(writeEs);
+                    doNotOptimize(buf);
+                }
+                return buf.size();
+            });
+    }
+
+private:
+    Registry& registry_;
+};
+
+} // namespace
+
+void registerStackBenchmarks(Registry& registry)
+{
+    comms::util::tupleForEachType<AllMessages>(MsgBenchRegistrar(registry));
+
+    Stack stack;
+    auto frames = demoAllFrames<AllMessages>(stack);
+    registry.add(
+        "stack", "AllMessages/read",
+        [frames](std::size_t iterations) -> std::size_t
+        {
+            Stack readStack;
+            for (std::size_t idx = 0U; idx < iterations; ++idx) {
+                const std::uint8_t* readIter = frames.data();
+                auto remLen = frames.size();
+                while (0U < remLen) {
+                    Stack::MsgPtr msgPtr;
+                    auto fromIter = readIter;
+                    auto es = readStack.read(msgPtr, readIter, remLen);
+                    doNotOptimize(msgPtr);
+                    if (es != comms::ErrorStatus::Success) {
+                        break;
+                    }
+                    remLen -= static_cast<std::size_t>(std::distance(fromIter, readIter));
+                }
+            }
+            return frames.size();
+        });
+}
+
+} // namespace comms_bench
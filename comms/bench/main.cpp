@@ -0,0 +1,217 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "comms/version.h"
+#include "Bench.h"
+
+namespace comms_bench
+{
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+double measureNs(const Registry::Func& func, std::size_t iterations, std::size_t& bytes)
+{
+    auto start = Clock::now();
+    bytes = func(iterations);
+    auto end = Clock::now();
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+std::string escape(const std::string& str)
+{
+    std::string result;
+    for (auto ch : str) {
+        if ((ch == '"') || (ch == '\\')) {
+            result += '\\';
+        }
+        result += ch;
+    }
+    return result;
+}
+
+const char* compilerName()
+{
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc";
+#else
+    return "unknown";
+#endif
+}
+
+} // namespace
+
+void printUsage(const char* app)
+{
+    std::cerr <<
+        "Usage: " << app << " [options]\n"
+        "  --filter <str>       Run only benchmarks containing <str> in \"group/name\"\n"
+        "  --min-time <ms>      Minimal duration of a single repetition (default 200)\n"
+        "  --repetitions <num>  Number of repetitions (default 5)\n"
+        "  --output <file>      Write JSON report into file instead of stdout\n";
+}
+
+void Registry::add(const std::string& group, const std::string& name, Func func)
+{
+    entries_.push_back(Entry{group, name, std::move(func)});
+}
+
+std::size_t Registry::run(const Config& config, std::ostream& out) const
+{
+    out <<
+        "{\n"
+        "  \"library\": \"comms\",\n"
+        "  \"version\": \"" << COMMS_MAJOR_VERSION << '.' << COMMS_MINOR_VERSION << '.' << COMMS_PATCH_VERSION << "\",\n"
+        "  \"compiler\": \"" << escape(compilerName()) << "\",\n"
+        "  \"cxx_standard\": " << __cplusplus << ",\n"
+        "  \"min_time_ms\": " << config.minTimeMs << ",\n"
+        "  \"repetitions\": " << config.repetitions << ",\n"
+        "  \"benchmarks\": [";
+
+    auto minTimeNs = static_cast<double>(config.minTimeMs) * 1000000.0;
+    std::size_t count = 0U;
+    for (auto& e : entries_) {
+        auto fullName = e.group + '/' + e.name;
+        if ((!config.filter.empty()) && (fullName.find(config.filter) == std::string::npos)) {
+            continue;
+        }
+
+        std::cerr << "Running " << fullName << "..." << std::endl;
+
+        std::size_t bytes = 0U;
+        std::size_t iterations = 1U;
+        while (true) {
+            auto elapsed = measureNs(e.func, iterations, bytes);
+            if ((minTimeNs / 10) <= elapsed) {
+                auto scaled = static_cast<double>(iterations) * minTimeNs / elapsed;
+                iterations = std::max(static_cast<std::size_t>(scaled), std::size_t(1U));
+                break;
+            }
+
+            iterations *= 2U;
+        }
+
+        std::vector<double> results;
+        for (auto rep = 0U; rep < std::max(config.repetitions, std::size_t(1U)); ++rep) {
+            auto elapsed = measureNs(e.func, iterations, bytes);
+            results.push_back(elapsed / static_cast<double>(iterations));
+        }
+
+        std::sort(results.begin(), results.end());
+        auto median = results[results.size() / 2];
+        double mean = 0.0;
+        for (auto r : results) {
+            mean += r;
+        }
+        mean /= static_cast<double>(results.size());
+
+        double mbPerSec = 0.0;
+        if ((0U < bytes) && (0.0 < median)) {
+            mbPerSec = (static_cast<double>(bytes) * 1000.0) / median;
+        }
+
+        if (0U < count) {
+            out << ',';
+        }
+
+        out <<
+            "\n    {\n"
+            "      \"group\": \"" << escape(e.group) << "\",\n"
+            "      \"name\": \"" << escape(e.name) << "\",\n"
+            "      \"iterations\": " << iterations << ",\n"
+            "      \"ns_per_iter_min\": " << results.front() << ",\n"
+            "      \"ns_per_iter_median\": " << median << ",\n"
+            "      \"ns_per_iter_mean\": " << mean << ",\n"
+            "      \"ns_per_iter_max\": " << results.back() << ",\n"
+            "      \"bytes_per_iter\": " << bytes << ",\n"
+            "      \"mb_per_sec\": " << mbPerSec << "\n"
+            "    }";
+        ++count;
+    }
+
+    out << "\n  ]\n}\n";
+    return count;
+}
+
+} // namespace comms_bench
+
+int main(int argc, const char* argv[])
+{
+    comms_bench::Registry::Config config;
+    std::string outputFile;
+    for (int idx = 1; idx < argc; ++idx) {
+        auto hasValue = ((idx + 1) < argc);
+        if ((std::strcmp(argv[idx], "--filter") == 0) && hasValue) {
+            config.filter = argv[++idx];
+            continue;
+        }
+
+        if ((std::strcmp(argv[idx], "--min-time") == 0) && hasValue) {
+            config.minTimeMs = static_cast<std::size_t>(std::strtoul(argv[++idx], nullptr, 10));
+            continue;
+        }
+
+        if ((std::strcmp(argv[idx], "--repetitions") == 0) && hasValue) {
+            config.repetitions = static_cast<std::size_t>(std::strtoul(argv[++idx], nullptr, 10));
+            continue;
+        }
+
+        if ((std::strcmp(argv[idx], "--output") == 0) && hasValue) {
+            outputFile = argv[++idx];
+            continue;
+        }
+
+        comms_bench::printUsage(argv[0]);
+        return -1;
+    }
+
+    comms_bench::Registry registry;
+    comms_bench::registerFieldBenchmarks(registry);
+    comms_bench::registerStackBenchmarks(registry);
+    comms_bench::registerDispatchBenchmarks(registry);
+    comms_bench::registerAllocBenchmarks(registry);
+    comms_bench::registerChecksumBenchmarks(registry);
+
+    if (outputFile.empty()) {
+        registry.run(config, std::cout);
+        return 0;
+    }
+
+    std::ofstream stream(outputFile);
+    if (!stream) {
+        std::cerr << "ERROR: Failed to open " << outputFile << " for writing" << std::endl;
+        return -1;
+    }
+
+    registry.run(config, stream);
+    return 0;
+}
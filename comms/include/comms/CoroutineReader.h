@@ -0,0 +1,266 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of @ref comms::CoroutineReader.
+/// @details The definition is available only when the compiler supports
+///     C++20 coroutines, which is reported by the @ref COMMS_HAS_COROUTINES
+///     macro.
+
+#pragma once
+
+#if defined(__has_include)
+#if __has_include(<coroutine>) && defined(__cpp_impl_coroutine) && (__cplusplus >= 202002L)
+#define COMMS_HAS_COROUTINES 1
+#endif
+#endif
+
+#ifndef COMMS_HAS_COROUTINES
+/// @brief Equals to 1 when C++20 coroutines are supported and
+///     @ref comms::CoroutineReader is defined, 0 otherwise.
+#define COMMS_HAS_COROUTINES 0
+#endif
+
+#if COMMS_HAS_COROUTINES
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "comms/ErrorStatus.h"
+#include "comms/Assert.h"
+#include "comms/process.h"
+
+namespace comms
+{
+
+/// @brief Adapter allowing coroutines to @b co_await the next decoded message.
+/// @details The raw input data is provided by the asynchronous byte source
+///     using @ref feed(), which accumulates it in the internal buffer.
+///     The consumer coroutine awaits the result of @ref next() to get the next
+///     decoded message object. The decoding is performed using
+///     @ref comms::processSingle(), i.e. the malformed data is skipped,
+///     the incomplete frame is kept until the rest of its data is fed, and
+///     the messages pending in the protocol stack (see @ref comms::protocol::MsgBatchLayer)
+///     are returned before consuming any new input.
+///     @code
+///     using Reader = comms::CoroutineReader<MyProtocolStack>;
+///     MyProtocolStack stack;
+///     Reader reader(stack);
+///
+///     MyTask handleConnection(Reader& reader, MyHandler& handler)
+///     {
+///         while (true) {
+///             auto msg = co_await reader.next();
+///             if (!msg) {
+///                 break; // closed
+///             }
+///             msg->dispatch(handler);
+///         }
+///     }
+///
+///     ...
+///     // In the read completion callback of the connection
+///     reader.feed(data, bytesReceived);
+///     ...
+///     // When the connection is terminated
+///     reader.close();
+///     @endcode
+///     The awaiting coroutine is resumed from within the @ref feed() or
+///     @ref close() call when the message becomes available. The object is
+///     not thread safe, feeding the data and awaiting the messages are
+///     expected to be performed on the same thread (or be externally synchronised).
+/// @note The internal buffer is compacted when new data is fed. Do not use
+///     @ref comms::option::app::OrigDataView fields with this reader.
+/// @tparam TFrame Protocol stack (frame) type.
+/// @tparam TBuffer Type of the internal buffer, expected to be @b std::vector
+///     like container with elements convertible to the read iterator of the
+///     message interface.
+/// @headerfile comms/CoroutineReader.h
+template <typename TFrame, typename TBuffer = std::vector<std::uint8_t> >
+class CoroutineReader
+{
+public:
+    /// @brief Type of the protocol stack (frame)
+    using Frame = TFrame;
+
+    /// @brief Type of the smart pointer to the message object
+    using MsgPtr = typename Frame::MsgPtr;
+
+    /// @brief Type of the internal buffer
+    using Buffer = TBuffer;
+
+    /// @brief Awaitable object returned by @ref next().
+    class NextAwaitable
+    {
+    public:
+        /// @brief Constructor
+        explicit NextAwaitable(CoroutineReader& reader) : reader_(reader) {}
+
+        /// @brief Check whether the message is available without suspension.
+        bool await_ready()
+        {
+            return reader_.tryRead(msg_);
+        }
+
+        /// @brief Suspend the awaiting coroutine until the message is available.
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            reader_.suspend(handle, msg_);
+        }
+
+        /// @brief Retrieve the decoded message.
+        /// @return Smart pointer to the message object, empty one
+        ///     when the reader is closed and no more messages are available.
+        MsgPtr await_resume()
+        {
+            return std::move(msg_);
+        }
+
+    private:
+        CoroutineReader& reader_;
+        MsgPtr msg_;
+    };
+
+    /// @brief Constructor
+    /// @param[in] frame Protocol stack (frame) used to decode the input.
+    explicit CoroutineReader(Frame& frame) : frame_(frame) {}
+
+    /// @brief Copy constructor is deleted
+    CoroutineReader(const CoroutineReader&) = delete;
+
+    /// @brief Copy assignment is deleted
+    CoroutineReader& operator=(const CoroutineReader&) = delete;
+
+    /// @brief Await the next decoded message.
+    /// @details Must not be awaited by more than one coroutine at a time.
+    NextAwaitable next()
+    {
+        return NextAwaitable(*this);
+    }
+
+    /// @brief Provide new input data.
+    /// @details Resumes the awaiting coroutine if the new message becomes available.
+    template <typename TIter>
+    void feed(TIter first, TIter last)
+    {
+        compact();
+        buf_.insert(buf_.end(), first, last);
+        resumeIfReady();
+    }
+
+    /// @brief Provide new input data.
+    /// @details Resumes the awaiting coroutine if the new message becomes available.
+    template <typename T>
+    void feed(const T* data, std::size_t len)
+    {
+        feed(data, data + len);
+    }
+
+    /// @brief Report end of the input.
+    /// @details The awaiting coroutine receives empty @ref MsgPtr after all
+    ///     the buffered messages are retrieved.
+    void close()
+    {
+        closed_ = true;
+        resumeIfReady();
+    }
+
+    /// @brief Check whether @ref close() has been called.
+    bool isClosed() const
+    {
+        return closed_;
+    }
+
+    /// @brief Number of bytes that have been fed, but not consumed yet.
+    std::size_t bufferedSize() const
+    {
+        return buf_.size() - offset_;
+    }
+
+private:
+    bool tryRead(MsgPtr& msg)
+    {
+        while (true) {
+            auto len = bufferedSize();
+            const typename Buffer::value_type* fromIter = buf_.data() + offset_;
+            auto iter = fromIter;
+            auto es = comms::processSingle(iter, len, frame_, msg);
+            offset_ += static_cast<std::size_t>(std::distance(fromIter, iter));
+            COMMS_ASSERT(offset_ <= buf_.size());
+
+            if (es == comms::ErrorStatus::Success) {
+                return true;
+            }
+
+            msg = MsgPtr();
+            if (es == comms::ErrorStatus::NotEnoughData) {
+                return closed_;
+            }
+
+            // Invalid message has been skipped, try the next one
+        }
+    }
+
+    void suspend(std::coroutine_handle<> handle, MsgPtr& msg)
+    {
+        COMMS_ASSERT(!waiter_);
+        waiter_ = handle;
+        waitingMsg_ = &msg;
+    }
+
+    void resumeIfReady()
+    {
+        if (!waiter_) {
+            return;
+        }
+
+        COMMS_ASSERT(waitingMsg_ != nullptr);
+        if (!tryRead(*waitingMsg_)) {
+            return;
+        }
+
+        auto handle = waiter_;
+        waiter_ = nullptr;
+        waitingMsg_ = nullptr;
+        handle.resume();
+    }
+
+    void compact()
+    {
+        if (offset_ == 0U) {
+            return;
+        }
+
+        buf_.erase(buf_.begin(), buf_.begin() + static_cast<std::ptrdiff_t>(offset_));
+        offset_ = 0U;
+    }
+
+    Frame& frame_;
+    Buffer buf_;
+    std::size_t offset_ = 0U;
+    std::coroutine_handle<> waiter_;
+    MsgPtr* waitingMsg_ = nullptr;
+    bool closed_ = false;
+};
+
+} // namespace comms
+
+#endif // #if COMMS_HAS_COROUTINES
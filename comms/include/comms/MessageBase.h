@@ -81,6 +81,8 @@ namespace comms
 ///     @li @ref comms::option::app::NoLengthImpl - Inhibit the implementation of lengthImpl().
 ///     @li @ref comms::option::app::NoValidImpl - Inhibit the implementation of validImpl().
 ///     @li @ref comms::option::app::NoDispatchImpl - Inhibit the implementation of dispatchImpl().
+///     @li @ref comms::option::app::CachedLength - Cache the result of doLength()
+///         until the fields are accessed for modification.
 /// @extends Message
 /// @headerfile comms/MessageBase.h
 /// @see @ref toMessageBase()
@@ -205,7 +207,9 @@ public:
     ///     This function will invoke such "length()" member function for every
     ///     field object listed with @ref comms::option::def::FieldsImpl option. The
     ///     final result is a summary of the "length" values of all the
-    ///     fields.
+    ///     fields. When @ref comms::option::app::CachedLength option is
+    ///     used, the calculated value is reused until the fields are accessed
+    ///     via non-const @ref fields() or the message is written or refreshed.
     /// @return Serialisation length of the message.
     std::size_t doLength() const;
 
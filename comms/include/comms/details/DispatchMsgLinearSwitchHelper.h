@@ -451,7 +451,7 @@ public:
             "The used message object must provide polymorphic ID retrieval function");
         static_assert(MsgType::hasMsgIdType(), 
             "Message interface class must define its id type");            
-        return dispatch(msg.getId(), msg, handler, AdjustedTag<MsgType>());
+        return dispatch(msg.getId(), msg, handler);
     }
 
     template <typename TId, typename TMsg, typename THandler>
@@ -0,0 +1,134 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "comms/details/detect.h"
+
+namespace comms
+{
+
+namespace details
+{
+
+template <
+    typename TMsg,
+    bool TIsMessage = hasInterfaceOptions<TMsg>(),
+    bool THasElementType = hasElementType<TMsg>()>
+struct InstrumentationMsgInterface
+{
+    using Type = void;
+};
+
+template <typename TMsg, bool THasElementType>
+struct InstrumentationMsgInterface<TMsg, true, THasElementType>
+{
+    using Type = TMsg;
+};
+
+template <typename TMsg>
+struct InstrumentationMsgInterface<TMsg, false, true>
+{
+    using Type = typename InstrumentationMsgInterface<typename TMsg::element_type>::Type;
+};
+
+template <typename TInterface, bool THasInterfaceOptions = hasInterfaceOptions<TInterface>()>
+struct InstrumentationPolicyRetriever
+{
+    using Type = void;
+};
+
+template <typename TOpts, bool THasInstrumentation = TOpts::HasInstrumentation>
+struct InstrumentationPolicyFromOptions
+{
+    using Type = void;
+};
+
+template <typename TOpts>
+struct InstrumentationPolicyFromOptions<TOpts, true>
+{
+    using Type = typename TOpts::Instrumentation;
+};
+
+template <typename TInterface>
+struct InstrumentationPolicyRetriever<TInterface, true>
+{
+    using Type = typename InstrumentationPolicyFromOptions<typename TInterface::InterfaceOptions>::Type;
+};
+
+/// Instrumentation policy (comms::option::app::Instrumentation) of the message
+/// interface, TMsg can be either message object or smart pointer to it,
+/// void when instrumentation is not used.
+template <typename TMsg>
+using InstrumentationPolicyT =
+    typename InstrumentationPolicyRetriever<
+        typename InstrumentationMsgInterface<typename std::decay<TMsg>::type>::Type
+    >::Type;
+
+struct InstrumentedTag {};
+struct NotInstrumentedTag {};
+
+template <typename TMsg>
+using InstrumentationTag =
+    typename std::conditional<
+        std::is_void<InstrumentationPolicyT<TMsg> >::value,
+        NotInstrumentedTag,
+        InstrumentedTag
+    >::type;
+
+class InstrumentationHelper
+{
+public:
+    template <typename TIter>
+    static std::size_t distance(const TIter& from, const TIter& to)
+    {
+        using Tag =
+            typename std::conditional<
+                std::is_base_of<
+                    std::random_access_iterator_tag,
+                    typename std::iterator_traits<TIter>::iterator_category
+                >::value,
+                RandomAccessTag,
+                OtherTag
+            >::type;
+        return distanceInternal(from, to, Tag());
+    }
+
+private:
+    struct RandomAccessTag {};
+    struct OtherTag {};
+
+    template <typename TIter>
+    static std::size_t distanceInternal(const TIter& from, const TIter& to, RandomAccessTag)
+    {
+        return static_cast<std::size_t>(std::distance(from, to));
+    }
+
+    template <typename TIter>
+    static std::size_t distanceInternal(const TIter&, const TIter&, OtherTag)
+    {
+        return 0U;
+    }
+};
+
+} // namespace details
+
+} // namespace comms
@@ -20,13 +20,19 @@
 
 #include <type_traits>
 #include <cstddef>
+#include <cstdint>
 #include <tuple>
+#include <algorithm>
+#include <iterator>
+#include <limits>
 
 #include "comms/CompileControl.h"
 #include "comms/Assert.h"
 #include "comms/util/access.h"
 #include "comms/util/Tuple.h"
 #include "comms/ErrorStatus.h"
+#include "comms/field/OptionalMode.h"
+#include "comms/field/tag.h"
 #include "MessageImplOptionsParser.h"
 
 namespace comms
@@ -170,14 +176,71 @@ using MessageImplNoIdBaseT =
 
 //----------------------------------------------------
 
-template <typename TAllFields>
-class MessageImplFieldsContainer
+template <bool TEnabled>
+class MessageImplLengthCache
 {
+protected:
+    bool isLengthCached() const
+    {
+        return cached_;
+    }
+
+    std::size_t cachedLength() const
+    {
+        return length_;
+    }
+
+    void cacheLength(std::size_t len) const
+    {
+        length_ = len;
+        cached_ = true;
+    }
+
+    void invalidateLength() const
+    {
+        cached_ = false;
+    }
+
+private:
+    mutable std::size_t length_ = 0U;
+    mutable bool cached_ = false;
+};
+
+template <>
+class MessageImplLengthCache<false>
+{
+protected:
+    static constexpr bool isLengthCached()
+    {
+        return false;
+    }
+
+    static constexpr std::size_t cachedLength()
+    {
+        return 0U;
+    }
+
+    static void cacheLength(std::size_t)
+    {
+    }
+
+    static void invalidateLength()
+    {
+    }
+};
+
+template <typename TAllFields, bool TCachedLength = false>
+class MessageImplFieldsContainer : public MessageImplLengthCache<TCachedLength>
+{
+    using LengthCache = MessageImplLengthCache<TCachedLength>;
+
 public:
     using AllFields = TAllFields;
 
     AllFields& fields()
     {
+        // Any field may be modified via the returned reference
+        LengthCache::invalidateLength();
         return fields_;
     }
 
@@ -237,7 +300,11 @@ public:
 #pragma warning( pop )
 #endif
 
-        return doWriteInternal(iter, size, Tag());
+        auto es = doWriteInternal(iter, size, Tag());
+        // The fields may have been modified via references kept
+        // since the length was cached, recalculate for the next write.
+        LengthCache::invalidateLength();
+        return es;
     }
 
     bool doValid() const
@@ -247,7 +314,13 @@ public:
 
     std::size_t doLength() const
     {
-        return util::tupleAccumulate(fields(), static_cast<std::size_t>(0U), FieldLengthRetriever());
+        if (LengthCache::isLengthCached()) {
+            return LengthCache::cachedLength();
+        }
+
+        auto len = util::tupleAccumulate(fields(), static_cast<std::size_t>(0U), FieldLengthRetriever());
+        LengthCache::cacheLength(len);
+        return len;
     }
 
     template <std::size_t TFromIdx>
@@ -328,7 +401,9 @@ public:
 
     bool doRefresh()
     {
-        return util::tupleAccumulate(fields(), false, FieldRefresher());
+        auto updated = util::tupleAccumulate(fields(), false, FieldRefresher());
+        LengthCache::invalidateLength();
+        return updated;
     }
 
 protected:
@@ -421,6 +496,7 @@ protected:
     {
         auto status = comms::ErrorStatus::Success;
         util::tupleForEachUntil<TIdx>(fields(), makeFieldWriter(iter, status, len));
+        LengthCache::invalidateLength();
         return status;
     }    
 
@@ -428,6 +504,7 @@ protected:
     void doWriteNoStatusUntil(TIter& iter) const
     {
         util::tupleForEachUntil<TIdx>(fields(), makeFieldNoStatusWriter(iter));
+        LengthCache::invalidateLength();
     }
 
     template <std::size_t TIdx, typename TIter>
@@ -445,6 +522,7 @@ protected:
     {
         auto status = comms::ErrorStatus::Success;
         util::tupleForEachFrom<TIdx>(fields(), makeFieldWriter(iter, status, len));
+        LengthCache::invalidateLength();
         return status;
     }    
 
@@ -452,6 +530,7 @@ protected:
     void doWriteNoStatusFrom(TIter& iter) const
     {
         util::tupleForEachFrom<TIdx>(fields(), makeFieldNoStatusWriter(iter));
+        LengthCache::invalidateLength();
     }
 
     template <std::size_t TFromIdx, std::size_t TUntilIdx, typename TIter>
@@ -469,6 +548,7 @@ protected:
     {
         auto status = comms::ErrorStatus::Success;
         util::tupleForEachFromUntil<TFromIdx, TUntilIdx>(fields(), makeFieldWriter(iter, status, len));
+        LengthCache::invalidateLength();
         return status;
     }    
 
@@ -476,6 +556,7 @@ protected:
     void doWriteNoStatusFromUntil(TIter& iter) const
     {
         util::tupleForEachFromUntil<TFromIdx, TUntilIdx>(fields(), makeFieldNoStatusWriter(iter));
+        LengthCache::invalidateLength();
     }
 
 private:
@@ -759,10 +840,10 @@ private:
 
 //----------------------------------------------------
 
-template <typename TBase, typename TAllFields>
-class MessageImplFieldsBase : public TBase, public MessageImplFieldsContainer<TAllFields>
+template <typename TBase, typename TAllFields, bool TCachedLength>
+class MessageImplFieldsBase : public TBase, public MessageImplFieldsContainer<TAllFields, TCachedLength>
 {
-    using ContainerBase = MessageImplFieldsContainer<TAllFields>;
+    using ContainerBase = MessageImplFieldsContainer<TAllFields, TCachedLength>;
 public:
     using ContainerBase::doRead;
     using ContainerBase::doWrite;
@@ -812,7 +893,7 @@ template <>
 struct MessageImplProcessFieldsBase<true>
 {
     template <typename TBase, typename TOpt>
-    using Type = MessageImplFieldsBase<TBase, typename TOpt::Fields>;
+    using Type = MessageImplFieldsBase<TBase, typename TOpt::Fields, TOpt::HasCachedLength>;
 };
 
 template <>
@@ -884,28 +965,435 @@ private:
     };
 };
 
-template <bool THasVersion>
+template <typename T, typename TEnable = void>
+struct MessageImplFieldVersionsRange
+{
+    static const bool Value = false;
+};
+
+template <typename T>
+struct MessageImplFieldVersionsRange<T, typename std::conditional<true, void, typename T::Tag>::type>
+{
+    static const bool Value =
+        std::is_same<typename T::Tag, comms::field::tag::Optional>::value &&
+        T::ParsedOptions::HasVersionsRange &&
+        (!T::ParsedOptions::HasVersionStorage) &&
+        (!T::ParsedOptions::HasCustomVersionUpdate);
+};
+
+template <typename TField>
+constexpr bool messageImplFieldHasStaticVersionsRange()
+{
+    return MessageImplFieldVersionsRange<TField>::Value;
+}
+
+constexpr std::uintmax_t messageImplVersionClamp(std::uintmax_t version, std::uintmax_t maxVersion)
+{
+    return version < maxVersion ? version : maxVersion;
+}
+
+template <typename TField, std::uintmax_t TVersion>
+constexpr bool messageImplFieldExistsInVersion()
+{
+    using VersionType = typename TField::VersionType;
+    using ParsedOptions = typename TField::ParsedOptions;
+    return
+        (messageImplVersionClamp(ParsedOptions::ExistsFromVersion, static_cast<std::uintmax_t>(std::numeric_limits<VersionType>::max())) <=
+            static_cast<std::uintmax_t>(static_cast<VersionType>(TVersion))) &&
+        (static_cast<std::uintmax_t>(static_cast<VersionType>(TVersion)) <=
+            messageImplVersionClamp(ParsedOptions::ExistsUntilVersion, static_cast<std::uintmax_t>(std::numeric_limits<VersionType>::max())));
+}
+
+template <typename TField, std::uintmax_t TVersion, bool THasStaticVersionsRange>
+struct MessageImplFieldMissingInVersion
+{
+    static const bool Value = false;
+};
+
+template <typename TField, std::uintmax_t TVersion>
+struct MessageImplFieldMissingInVersion<TField, TVersion, true>
+{
+    static const bool Value = !messageImplFieldExistsInVersion<TField, TVersion>();
+};
+
+template <typename TVersions>
+struct MessageImplVersionIdxFinder;
+
+template <typename... TVersions>
+struct MessageImplVersionIdxFinder<std::tuple<TVersions...> >
+{
+    static std::size_t find(std::uintmax_t version)
+    {
+        static const std::uintmax_t Versions[] = {TVersions::value...};
+        return static_cast<std::size_t>(
+            std::distance(
+                std::begin(Versions),
+                std::find(std::begin(Versions), std::end(Versions), version)));
+    }
+};
+
+template <typename TBase, typename TOpt>
+class MessageImplVersionSpecificBase : public TBase
+{
+    using Versions = typename TOpt::VersionSpecificImplVersions;
+
+public:
+    using VersionType = typename TBase::VersionType;
+
+    bool doFieldsVersionUpdate()
+    {
+        bool updated = false;
+        if (dispatchVersion(VersionUpdateOp(*this, updated))) {
+            return updated;
+        }
+
+        return util::tupleAccumulate(TBase::fields(), false, FieldVersionUpdater(TBase::version()));
+    }
+
+    template <typename TIter>
+    comms::ErrorStatus doRead(TIter& iter, std::size_t len)
+    {
+        auto es = comms::ErrorStatus::Success;
+        if (dispatchVersion(ReadOp<TIter>(*this, iter, len, es))) {
+            return es;
+        }
+
+        util::tupleAccumulate(TBase::fields(), false, FieldVersionUpdater(TBase::version()));
+        return TBase::doRead(iter, len);
+    }
+
+    bool doRefresh()
+    {
+        bool updated = doFieldsVersionUpdate();
+        return TBase::doRefresh() || updated;
+    }
+
+protected:
+    MessageImplVersionSpecificBase()
+    {
+        doFieldsVersionUpdate();
+    }
+
+    MessageImplVersionSpecificBase(const MessageImplVersionSpecificBase&) = default;
+    MessageImplVersionSpecificBase(MessageImplVersionSpecificBase&&) = default;
+    ~MessageImplVersionSpecificBase() noexcept = default;
+
+    MessageImplVersionSpecificBase& operator=(const MessageImplVersionSpecificBase&) = default;
+    MessageImplVersionSpecificBase& operator=(MessageImplVersionSpecificBase&&) = default;
+
+private:
+    struct NoVersionFieldTag {};
+    struct StaticVersionFieldTag {};
+    struct DynamicVersionFieldTag {};
+
+    template <typename TField>
+    using FieldTag =
+        typename std::conditional<
+            !TField::isVersionDependent(),
+            NoVersionFieldTag,
+            typename std::conditional<
+                messageImplFieldHasStaticVersionsRange<TField>(),
+                StaticVersionFieldTag,
+                DynamicVersionFieldTag
+            >::type
+        >::type;
+
+    template <typename TOp>
+    bool dispatchVersion(TOp&& op)
+    {
+        auto idx = MessageImplVersionIdxFinder<Versions>::find(static_cast<std::uintmax_t>(TBase::version()));
+        if (std::tuple_size<Versions>::value <= idx) {
+            return false;
+        }
+
+        util::tupleForSelectedType<Versions>(idx, std::forward<TOp>(op));
+        return true;
+    }
+
+    template <std::uintmax_t TVersion>
+    bool updateFieldsForVersion()
+    {
+        return util::tupleAccumulate(TBase::fields(), false, FieldVersionSpecificUpdater<TVersion>());
+    }
+
+    template <std::uintmax_t TVersion, typename TIter>
+    comms::ErrorStatus readFieldsForVersion(TIter& iter, std::size_t len)
+    {
+        auto es = comms::ErrorStatus::Success;
+        util::tupleForEach(TBase::fields(), FieldVersionSpecificReader<TVersion, TIter>(iter, es, len));
+        return es;
+    }
+
+    class VersionUpdateOp
+    {
+    public:
+        VersionUpdateOp(MessageImplVersionSpecificBase& msg, bool& updated)
+          : msg_(msg),
+            updated_(updated)
+        {
+        }
+
+        template <std::size_t TIdx, typename TVersion>
+        void operator()()
+        {
+            updated_ = msg_.template updateFieldsForVersion<TVersion::value>();
+        }
+
+    private:
+        MessageImplVersionSpecificBase& msg_;
+        bool& updated_;
+    };
+
+    template <typename TIter>
+    class ReadOp
+    {
+    public:
+        ReadOp(MessageImplVersionSpecificBase& msg, TIter& iter, std::size_t len, comms::ErrorStatus& es)
+          : msg_(msg),
+            iter_(iter),
+            len_(len),
+            es_(es)
+        {
+        }
+
+        template <std::size_t TIdx, typename TVersion>
+        void operator()()
+        {
+            msg_.template updateFieldsForVersion<TVersion::value>();
+            es_ = msg_.template readFieldsForVersion<TVersion::value>(iter_, len_);
+        }
+
+    private:
+        MessageImplVersionSpecificBase& msg_;
+        TIter& iter_;
+        std::size_t len_ = 0U;
+        comms::ErrorStatus& es_;
+    };
+
+    struct FieldVersionUpdater
+    {
+        FieldVersionUpdater(VersionType version) : version_(version) {}
+
+        template <typename TField>
+        bool operator()(bool updated, TField& field) const
+        {
+            using FieldVersionType = typename std::decay<decltype(field)>::type::VersionType;
+            return field.setVersion(static_cast<FieldVersionType>(version_)) || updated;
+        }
+
+    private:
+        const VersionType version_ = static_cast<VersionType>(0);
+    };
+
+    template <std::uintmax_t TVersion>
+    struct FieldVersionSpecificUpdater
+    {
+        template <typename TField>
+        bool operator()(bool updated, TField& field) const
+        {
+            return updateField(field, FieldTag<TField>()) || updated;
+        }
+
+    private:
+        template <typename TField>
+        static bool updateField(TField& field, NoVersionFieldTag)
+        {
+            static_cast<void>(field);
+            return false;
+        }
+
+        template <typename TField>
+        static bool updateField(TField& field, DynamicVersionFieldTag)
+        {
+            using FieldVersionType = typename TField::VersionType;
+            return field.setVersion(static_cast<FieldVersionType>(TVersion));
+        }
+
+        template <typename TField>
+        static bool updateField(TField& field, StaticVersionFieldTag)
+        {
+            using InnerVersionType = typename TField::Field::VersionType;
+            bool updated = field.field().setVersion(static_cast<InnerVersionType>(TVersion));
+
+            static const auto Mode =
+                messageImplFieldExistsInVersion<TField, TVersion>() ?
+                    comms::field::OptionalMode::Exists :
+                    comms::field::OptionalMode::Missing;
+
+            if (field.getMode() == Mode) {
+                return updated;
+            }
+
+            field.setMode(Mode);
+            return true;
+        }
+    };
+
+    template <std::uintmax_t TVersion, typename TIter>
+    class FieldVersionSpecificReader
+    {
+    public:
+        FieldVersionSpecificReader(TIter& iter, comms::ErrorStatus& status, std::size_t& size)
+            : iter_(iter),
+              status_(status),
+              size_(size)
+        {
+        }
+
+        template <typename TField>
+        void operator()(TField& field)
+        {
+            using Tag =
+                typename std::conditional<
+                    MessageImplFieldMissingInVersion<
+                        TField,
+                        TVersion,
+                        std::is_same<FieldTag<TField>, StaticVersionFieldTag>::value
+                    >::Value,
+                    SkipTag,
+                    ReadTag
+                >::type;
+
+            readField(field, Tag());
+        }
+
+    private:
+        struct SkipTag {};
+        struct ReadTag {};
+
+        template <typename TField>
+        static void readField(TField& field, SkipTag)
+        {
+            static_cast<void>(field);
+        }
+
+        template <typename TField>
+        void readField(TField& field, ReadTag)
+        {
+            if (status_ == comms::ErrorStatus::Success) {
+                auto fromIter = iter_;
+                status_ = field.read(iter_, size_);
+                if (status_ == comms::ErrorStatus::Success) {
+                    auto diff = static_cast<std::size_t>(std::distance(fromIter, iter_));
+                    COMMS_ASSERT(diff <= size_);
+                    size_ -= diff;
+                }
+            }
+        }
+
+        TIter& iter_;
+        comms::ErrorStatus& status_;
+        std::size_t& size_;
+    };
+};
+
+template <bool THasVersion, bool THasVersionSpecificImpl>
 struct MessageImplProcessVersionBase;
 
 template <>
-struct MessageImplProcessVersionBase<true>
+struct MessageImplProcessVersionBase<true, false>
 {
-    template <typename TBase>
+    template <typename TBase, typename TOpt>
     using Type = MessageImplVersionBase<TBase>;
 };
 
 template <>
-struct MessageImplProcessVersionBase<false>
+struct MessageImplProcessVersionBase<true, true>
 {
-    template <typename TBase>
+    template <typename TBase, typename TOpt>
+    using Type = MessageImplVersionSpecificBase<TBase, TOpt>;
+};
+
+template <bool THasVersionSpecificImpl>
+struct MessageImplProcessVersionBase<false, THasVersionSpecificImpl>
+{
+    template <typename TBase, typename TOpt>
     using Type = TBase;
 };
 
 template <typename TBase, typename TOpt>
 using MessageImplVersionBaseT =
     typename MessageImplProcessVersionBase<
-            TOpt::HasFieldsImpl && TBase::InterfaceOptions::HasVersionInExtraTransportFields
-    >::template Type<TBase>;
+            TOpt::HasFieldsImpl && TBase::InterfaceOptions::HasVersionInExtraTransportFields,
+            TOpt::HasVersionSpecificImpl
+    >::template Type<TBase, TOpt>;
+
+//----------------------------------------------------
+
+template <typename TBase, typename TOpt>
+class MessageImplInstrumentationBase : public TBase
+{
+    using Policy = typename TBase::InterfaceOptions::Instrumentation;
+
+public:
+    template <typename TIter>
+    comms::ErrorStatus doRead(TIter& iter, std::size_t len)
+    {
+        using Tag =
+            typename std::conditional<
+                TOpt::HasMsgType,
+                HasActualTag,
+                NoActualTag
+            >::type;
+        return doReadInternal(iter, len, Tag());
+    }
+
+protected:
+    ~MessageImplInstrumentationBase() noexcept = default;
+
+private:
+    struct HasActualTag {};
+    struct NoActualTag {};
+
+    template <typename TIter>
+    comms::ErrorStatus doReadInternal(TIter& iter, std::size_t len, HasActualTag)
+    {
+        return doReadInstrumented(static_cast<const typename TOpt::MsgType&>(*this), iter, len);
+    }
+
+    template <typename TIter>
+    comms::ErrorStatus doReadInternal(TIter& iter, std::size_t len, NoActualTag)
+    {
+        return doReadInstrumented(*this, iter, len);
+    }
+
+    template <typename TMsg, typename TIter>
+    comms::ErrorStatus doReadInstrumented(const TMsg& msg, TIter& iter, std::size_t len)
+    {
+        auto start = Policy::template msgReadBegin<TMsg>();
+        auto fromIter = iter;
+        auto es = TBase::doRead(iter, len);
+        Policy::template msgReadEnd<TMsg>(
+            start,
+            msg,
+            static_cast<std::size_t>(std::distance(fromIter, iter)),
+            es);
+        return es;
+    }
+};
+
+template <bool THasInstrumentation>
+struct MessageImplProcessInstrumentationBase;
+
+template <>
+struct MessageImplProcessInstrumentationBase<true>
+{
+    template <typename TBase, typename TOpt>
+    using Type = MessageImplInstrumentationBase<TBase, TOpt>;
+};
+
+template <>
+struct MessageImplProcessInstrumentationBase<false>
+{
+    template <typename TBase, typename TOpt>
+    using Type = TBase;
+};
+
+template <typename TBase, typename TOpt>
+using MessageImplInstrumentationBaseT =
+    typename MessageImplProcessInstrumentationBase<
+        TOpt::HasFieldsImpl && TBase::InterfaceOptions::HasInstrumentation
+    >::template Type<TBase, TOpt>;
 
 //----------------------------------------------------
 
@@ -1388,7 +1876,8 @@ class MessageImplBuilder
 
     using FieldsBase = MessageImplFieldsBaseT<TMessage, ParsedOptions>;
     using VersionBase = MessageImplVersionBaseT<FieldsBase, ParsedOptions>;
-    using StaticNumIdBase = MessageImplStaticNumIdBaseT<VersionBase, ParsedOptions>;
+    using InstrumentationBase = MessageImplInstrumentationBaseT<VersionBase, ParsedOptions>;
+    using StaticNumIdBase = MessageImplStaticNumIdBaseT<InstrumentationBase, ParsedOptions>;
     using PolymorphicStaticNumIdBase = MessageImplPolymorhpicStaticNumIdBaseT<StaticNumIdBase, ParsedOptions>;
     using NoIdBase = MessageImplNoIdBaseT<PolymorphicStaticNumIdBase, ParsedOptions>;
     using FieldsReadImplBase = MessageImplFieldsReadImplBaseT<NoIdBase, ParsedOptions>;
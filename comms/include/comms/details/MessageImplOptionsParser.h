@@ -18,6 +18,9 @@
 
 #pragma once
 
+#include <tuple>
+#include <type_traits>
+
 #include "comms/options.h"
 
 namespace comms
@@ -46,6 +49,8 @@ public:
     static const bool HasCustomRefresh = false;
     static const bool HasName = false;
     static const bool HasDoGetId = false;
+    static const bool HasVersionSpecificImpl = false;
+    static const bool HasCachedLength = false;
 };
 
 template <std::intmax_t TId,
@@ -149,6 +154,32 @@ public:
     static const bool HasNoRefreshImpl = true;
 };
 
+template <std::uintmax_t... TVersions,
+          typename... TOptions>
+class MessageImplOptionsParser<
+    comms::option::app::VersionSpecificImpl<TVersions...>,
+    TOptions...> : public MessageImplOptionsParser<TOptions...>
+{
+    using BaseImpl = MessageImplOptionsParser<TOptions...>;
+
+    static_assert(!BaseImpl::HasVersionSpecificImpl,
+        "comms::option::app::VersionSpecificImpl option is used more than once");
+    static_assert(0U < sizeof...(TVersions),
+        "comms::option::app::VersionSpecificImpl option requires at least one version");
+public:
+    static const bool HasVersionSpecificImpl = true;
+    using VersionSpecificImplVersions = std::tuple<std::integral_constant<std::uintmax_t, TVersions>...>;
+};
+
+template <typename... TOptions>
+class MessageImplOptionsParser<
+    comms::option::app::CachedLength,
+    TOptions...> : public MessageImplOptionsParser<TOptions...>
+{
+public:
+    static const bool HasCachedLength = true;
+};
+
 template <typename... TOptions>
 class MessageImplOptionsParser<
     comms::option::def::HasCustomRefresh,
@@ -50,6 +50,7 @@ public:
     static const bool HasNoVirtualDestructor = false;
     static const bool HasExtraTransportFields = false;
     static const bool HasVersionInExtraTransportFields = false;
+    static const bool HasInstrumentation = false;
 };
 
 template <typename T, typename... TOptions>
@@ -179,6 +180,16 @@ public:
     static const std::size_t VersionInExtraTransportFields = TIdx;
 };
 
+template <typename T, typename... TOptions>
+class MessageInterfaceOptionsParser<
+    comms::option::app::Instrumentation<T>,
+    TOptions...> : public MessageInterfaceOptionsParser<TOptions...>
+{
+public:
+    static const bool HasInstrumentation = true;
+    using Instrumentation = T;
+};
+
 template <typename... TOptions>
 class MessageInterfaceOptionsParser<
     comms::option::app::EmptyOption,
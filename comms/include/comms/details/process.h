@@ -17,10 +17,14 @@
 
 #pragma once
 
+#include <cstddef>
 #include <type_traits>
+#include <utility>
 
+#include "comms/ErrorStatus.h"
 #include "comms/Message.h"
 #include "comms/details/detect.h"
+#include "comms/protocol/ProtocolLayerBase.h"
 
 namespace  comms
 {
@@ -102,6 +106,159 @@ auto processMsgCastToMsgObj(T& msg) ->
     return ProcessMsgCastToMsgObjHelper<ProcessMsgCastParamPrepareHelper<decltype(msg)>::IsMessage, ProcessMsgCastParamPrepareHelper<decltype(msg)>::IsMsgPtr>::cast(msg);
 }
 
+template <typename... TExtraValues>
+struct ProcessHasReadStatisticsHelper
+{
+    static const bool Value = false;
+};
+
+template <typename T, typename... TExtraValues>
+struct ProcessHasReadStatisticsHelper<T, TExtraValues...>
+{
+    static const bool Value =
+        comms::protocol::details::isReadStatisticsRetriever<T>() ||
+        ProcessHasReadStatisticsHelper<TExtraValues...>::Value;
+};
+
+template <typename... TExtraValues>
+constexpr bool processHasReadStatistics()
+{
+    return ProcessHasReadStatisticsHelper<TExtraValues...>::Value;
+}
+
+class ProcessFrameReader
+{
+public:
+    template <typename TFrame, typename TMsg, typename TIter, typename... TExtraValues>
+    static comms::ErrorStatus read(
+        TFrame& frame,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t len,
+        TExtraValues... extraValues)
+    {
+        return readInternal(frame, msg, iter, len, StatsTag<TExtraValues...>(), extraValues...);
+    }
+
+    template <typename TFrame, typename TMsg, typename... TExtraValues>
+    static bool takePendingMsg(
+        TFrame& frame,
+        TMsg& msg,
+        TExtraValues... extraValues)
+    {
+        return takePendingMsgInternal(frame, msg, StatsTag<TExtraValues...>(), extraValues...);
+    }
+
+private:
+    struct NoStatsTag {};
+    struct HasStatsTag {};
+
+    template <typename... TExtraValues>
+    using StatsTag =
+        typename std::conditional<
+            processHasReadStatistics<TExtraValues...>(),
+            HasStatsTag,
+            NoStatsTag
+        >::type;
+
+    template <typename TFrame, typename TMsg, typename TIter, typename... TExtraValues>
+    static comms::ErrorStatus readInternal(
+        TFrame& frame,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t len,
+        NoStatsTag,
+        TExtraValues... extraValues)
+    {
+        return frame.read(msg, iter, len, extraValues...);
+    }
+
+    template <typename TFrame, typename TMsg, typename TIter, typename... TExtraValues>
+    static comms::ErrorStatus readInternal(
+        TFrame& frame,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t len,
+        HasStatsTag,
+        TExtraValues... extraValues)
+    {
+        using LocalMsgIdType = ProcessMsgIdType<TMsg>;
+        static_assert(!std::is_void<LocalMsgIdType>(), "Invalid type of msg param");
+
+        LocalMsgIdType id = LocalMsgIdType();
+        auto es = frame.read(msg, iter, len, comms::protocol::msgId(id), extraValues...);
+        if (es == comms::ErrorStatus::Success) {
+            comms::protocol::details::ReadStatisticsReporter::frame(id, extraValues...);
+        }
+        return es;
+    }
+
+    template <typename TFrame, typename TMsg, typename... TExtraValues>
+    static bool takePendingMsgInternal(
+        TFrame& frame,
+        TMsg& msg,
+        NoStatsTag,
+        TExtraValues... extraValues)
+    {
+        return frame.takePendingMsg(msg, extraValues...);
+    }
+
+    template <typename TFrame, typename TMsg, typename... TExtraValues>
+    static bool takePendingMsgInternal(
+        TFrame& frame,
+        TMsg& msg,
+        HasStatsTag,
+        TExtraValues... extraValues)
+    {
+        using LocalMsgIdType = ProcessMsgIdType<TMsg>;
+        static_assert(!std::is_void<LocalMsgIdType>(), "Invalid type of msg param");
+
+        LocalMsgIdType id = LocalMsgIdType();
+        if (!frame.takePendingMsg(msg, comms::protocol::msgId(id), extraValues...)) {
+            return false;
+        }
+
+        comms::protocol::details::ReadStatisticsReporter::frame(id, extraValues...);
+        return true;
+    }
+};
+
+class ProcessMsgRecycler
+{
+public:
+    template <typename TFrame, typename TMsgPtr>
+    static void recycle(TFrame& frame, TMsgPtr& msg)
+    {
+        using FrameType = typename std::decay<TFrame>::type;
+        using Tag =
+            typename std::conditional<
+                FrameType::hasMsgRecycling(),
+                RecycleTag,
+                NoRecycleTag
+            >::type;
+        recycleInternal(frame, msg, Tag());
+    }
+
+private:
+    struct NoRecycleTag {};
+    struct RecycleTag {};
+
+    template <typename TFrame, typename TMsgPtr>
+    static void recycleInternal(TFrame& frame, TMsgPtr& msg, NoRecycleTag)
+    {
+        static_cast<void>(frame);
+        static_cast<void>(msg);
+    }
+
+    template <typename TFrame, typename TMsgPtr>
+    static void recycleInternal(TFrame& frame, TMsgPtr& msg, RecycleTag)
+    {
+        if (msg) {
+            frame.recycleMsg(std::move(msg));
+        }
+    }
+};
+
 } // namespace details
 
 } // namespace  comms
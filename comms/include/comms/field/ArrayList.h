@@ -25,6 +25,7 @@
 #include "comms/ErrorStatus.h"
 #include "comms/options.h"
 #include "comms/util/StaticVector.h"
+#include "comms/util/SmallVector.h"
 #include "comms/util/ArrayView.h"
 #include "basic/ArrayList.h"
 #include "details/AdaptBasicField.h"
@@ -96,6 +97,24 @@ struct ArrayListFixedSizeStorageType<false>
             ::template Type<TElement, TOpt>;
 };
 
+template <bool THasSmallBufferStorage>
+struct ArrayListSmallBufferStorageType;
+
+template <>
+struct ArrayListSmallBufferStorageType<true>
+{
+    template <typename TElement, typename TOpt>
+    using Type = comms::util::SmallVector<TElement, TOpt::SmallBufferStorage>;
+};
+
+template <>
+struct ArrayListSmallBufferStorageType<false>
+{
+    template <typename TElement, typename TOpt>
+    using Type =
+        typename ArrayListFixedSizeStorageType<TOpt::HasFixedSizeStorage>::template Type<TElement, TOpt>;
+};
+
 template <bool THasCustomStorage>
 struct ArrayListCustomArrayListStorageType;
 
@@ -111,7 +130,7 @@ struct ArrayListCustomArrayListStorageType<false>
 {
     template <typename TElement, typename TOpt>
     using Type =
-        typename ArrayListFixedSizeStorageType<TOpt::HasFixedSizeStorage>::template Type<TElement, TOpt>;
+        typename ArrayListSmallBufferStorageType<TOpt::HasSmallBufferStorage>::template Type<TElement, TOpt>;
 };
 
 template <typename TElement, typename TOpt>
@@ -134,7 +153,9 @@ using ArrayListBase =
 /// @details By default uses
 ///     <a href="http://en.cppreference.com/w/cpp/container/vector">std::vector</a>,
 ///     for internal storage, unless @ref comms::option::app::FixedSizeStorage option is used,
-///     which forces usage of comms::util::StaticVector instead.
+///     which forces usage of comms::util::StaticVector instead, or
+///     @ref comms::option::app::SmallBufferStorage option is used, which forces
+///     usage of comms::util::SmallVector.
 /// @tparam TFieldBase Base class for this field, expected to be a variant of
 ///     comms::Field.
 /// @tparam TElement Element of the collection, can be either basic integral value
@@ -164,6 +185,7 @@ using ArrayListBase =
 ///     of the field.@n
 ///     Supported options are:
 ///     @li @ref comms::option::app::FixedSizeStorage
+///     @li @ref comms::option::app::SmallBufferStorage
 ///     @li @ref comms::option::app::CustomStorageType
 ///     @li @ref comms::option::app::OrigDataView (valid only if TElement is integral type
 ///         of 1 byte size.
@@ -213,7 +235,9 @@ public:
     /// @details If @ref comms::option::app::FixedSizeStorage option is NOT used, the
     ///     ValueType is std::vector<TElement>, otherwise it becomes
     ///     comms::util::StaticVector<TElement, TSize>, where TSize is a size
-    ///     provided to @ref comms::option::app::FixedSizeStorage option.
+    ///     provided to @ref comms::option::app::FixedSizeStorage option. If
+    ///     @ref comms::option::app::SmallBufferStorage option is used, the
+    ///     ValueType becomes comms::util::SmallVector<TElement, TSize>.
     using ValueType = typename BaseImpl::ValueType;
 
     /// @brief Type of the element.
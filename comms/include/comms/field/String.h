@@ -25,6 +25,7 @@
 #include "comms/ErrorStatus.h"
 #include "comms/options.h"
 #include "comms/util/StaticString.h"
+#include "comms/util/SmallString.h"
 #include "comms/util/StringView.h"
 #include "basic/String.h"
 #include "details/AdaptBasicField.h"
@@ -90,6 +91,24 @@ struct StringFixedSizeStorageType<false>
         ::template Type<TOpt>;
 };
 
+template <bool THasSmallBufferStorage>
+struct StringSmallBufferStorageType;
+
+template <>
+struct StringSmallBufferStorageType<true>
+{
+    template <typename TOpt>
+    using Type = comms::util::SmallString<TOpt::SmallBufferStorage>;
+};
+
+template <>
+struct StringSmallBufferStorageType<false>
+{
+    template <typename TOpt>
+    using Type =
+        typename StringFixedSizeStorageType<TOpt::HasFixedSizeStorage>::template Type<TOpt>;
+};
+
 template <bool THasCustomStorage>
 struct StringCustomStringStorageType;
 
@@ -105,7 +124,7 @@ struct StringCustomStringStorageType<false>
 {
     template <typename TOpt>
     using Type =
-        typename StringFixedSizeStorageType<TOpt::HasFixedSizeStorage>::template Type<TOpt>;
+        typename StringSmallBufferStorageType<TOpt::HasSmallBufferStorage>::template Type<TOpt>;
 };
 
 template <typename TOpt>
@@ -125,13 +144,16 @@ using StringBase =
 /// @details By default uses
 ///     <a href="http://en.cppreference.com/w/cpp/string/basic_string">std::string</a>,
 ///     for internal storage, unless @ref comms::option::app::FixedSizeStorage option is used,
-///     which forces usage of comms::util::StaticString instead.
+///     which forces usage of comms::util::StaticString instead, or
+///     @ref comms::option::app::SmallBufferStorage option is used, which forces
+///     usage of comms::util::SmallString.
 /// @tparam TFieldBase Base class for this field, expected to be a variant of
 ///     comms::Field.
 /// @tparam TOptions Zero or more options that modify/refine default behaviour
 ///     of the field.@n
 ///     Supported options are:
 ///     @li @ref comms::option::app::FixedSizeStorage
+///     @li @ref comms::option::app::SmallBufferStorage
 ///     @li @ref comms::option::app::CustomStorageType
 ///     @li @ref comms::option::app::OrigDataView
 ///     @li @ref comms::option::def::SequenceSizeFieldPrefix
@@ -175,7 +197,9 @@ public:
     /// @details If @ref comms::option::app::FixedSizeStorage option is NOT used, the
     ///     ValueType is std::string, otherwise it becomes
     ///     comms::util::StaticString<TSize>, where TSize is a size
-    ///     provided to @ref comms::option::app::FixedSizeStorage option.
+    ///     provided to @ref comms::option::app::FixedSizeStorage option. If
+    ///     @ref comms::option::app::SmallBufferStorage option is used, the
+    ///     ValueType becomes comms::util::SmallString<TSize>.
     using ValueType = typename BaseImpl::ValueType;
 
     /// @brief Default constructor
@@ -455,6 +455,8 @@ private:
             "comms::option::def::SequenceTerminationFieldSuffix option is not applicable to Variant field");
     static_assert(!ParsedOptions::HasFixedSizeStorage,
             "comms::option::app::FixedSizeStorage option is not applicable to Variant field");
+    static_assert(!ParsedOptions::HasSmallBufferStorage,
+            "comms::option::app::SmallBufferStorage option is not applicable to Variant field");
     static_assert(!ParsedOptions::HasCustomStorageType,
             "comms::option::app::CustomStorageType option is not applicable to Variant field");
     static_assert(!ParsedOptions::HasScalingRatio,
@@ -18,6 +18,12 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
 #include "comms/Assert.h"
 #include "comms/ErrorStatus.h"
 
@@ -125,6 +131,70 @@ public:
 private:
     struct RawDataTag {};
     struct FieldTag {};
+    struct TermByteSearchTag {};
+    struct TermFieldSearchTag {};
+
+    static constexpr bool hasSingleByteTermField()
+    {
+        return
+            (TermField::minLength() == sizeof(std::uint8_t)) &&
+            (TermField::maxLength() == sizeof(std::uint8_t)) &&
+            (std::is_integral<typename TermField::ValueType>::value ||
+             std::is_enum<typename TermField::ValueType>::value);
+    }
+
+    template <typename TIter>
+    static void findTermination(
+        const TIter& iter,
+        std::size_t len,
+        std::size_t& consumed,
+        std::size_t& termFieldLen,
+        TermFieldSearchTag)
+    {
+        TermField termField;
+        while (consumed < len) {
+            auto iterCpy = iter + consumed;
+            auto es = termField.read(iterCpy, len - consumed);
+            if ((es == comms::ErrorStatus::Success) &&
+                (termField == TermField())){
+                termFieldLen = static_cast<std::size_t>(std::distance(iter + consumed, iterCpy));
+                break;
+            }
+
+            ++consumed;
+        }
+    }
+
+    template <typename TIter>
+    static void findTermination(
+        const TIter& iter,
+        std::size_t len,
+        std::size_t& consumed,
+        std::size_t& termFieldLen,
+        TermByteSearchTag)
+    {
+        // The single byte terminator has only one serialised representation,
+        // search for it using memchr(), which is vectorised by the standard library.
+        if (len == 0U) {
+            return;
+        }
+
+        std::uint8_t termByte = 0U;
+        auto* termIter = &termByte;
+        auto es = TermField().write(termIter, sizeof(termByte));
+        static_cast<void>(es);
+        GASSERT(es == comms::ErrorStatus::Success);
+
+        auto* begin = reinterpret_cast<const std::uint8_t*>(iter);
+        auto* found = static_cast<const std::uint8_t*>(std::memchr(begin, termByte, len));
+        if (found == nullptr) {
+            consumed = len;
+            return;
+        }
+
+        consumed = static_cast<std::size_t>(std::distance(begin, found));
+        termFieldLen = sizeof(termByte);
+    }
 
     template <typename TIter>
     comms::ErrorStatus readInternal(TIter& iter, std::size_t len, FieldTag)
@@ -154,20 +224,19 @@ private:
     template <typename TIter>
     comms::ErrorStatus readInternal(TIter& iter, std::size_t len, RawDataTag)
     {
-        TermField termField;
+        using IterType = typename std::decay<decltype(iter)>::type;
+        using SearchTag =
+            typename std::conditional<
+                std::is_pointer<IterType>::value &&
+                    (sizeof(typename std::iterator_traits<IterType>::value_type) == sizeof(std::uint8_t)) &&
+                    hasSingleByteTermField(),
+                TermByteSearchTag,
+                TermFieldSearchTag
+            >::type;
+
         std::size_t consumed = 0U;
         std::size_t termFieldLen = 0U;
-        while (consumed < len) {
-            auto iterCpy = iter + consumed;
-            auto es = termField.read(iterCpy, len - consumed);
-            if ((es == comms::ErrorStatus::Success) &&
-                (termField == TermField())){
-                termFieldLen = static_cast<std::size_t>(std::distance(iter + consumed, iterCpy));
-                break;
-            }
-
-            ++consumed;
-        }
+        findTermination(iter, len, consumed, termFieldLen, SearchTag());
 
         if (len <= consumed) {
             return comms::ErrorStatus::NotEnoughData;
@@ -384,7 +384,7 @@ public:
     template <typename TIter>
     ErrorStatus write(TIter& iter, std::size_t len) const
     {
-        return CommonFuncs::writeSequence(*this, iter, len);
+        return writeInternal(iter, len, WriteTag());
     }
 
     static constexpr bool hasWriteNoStatus()
@@ -395,7 +395,7 @@ public:
     template <typename TIter>
     void writeNoStatus(TIter& iter) const
     {
-        CommonFuncs::writeSequenceNoStatus(*this, iter);
+        writeNoStatusInternal(iter, WriteTag());
     }
 
     template <typename TIter>
@@ -443,6 +443,12 @@ private:
         FieldElemTag
     >::type;
 
+    using WriteTag = typename std::conditional<
+        std::is_integral<ElementType>::value && (sizeof(ElementType) == sizeof(std::uint8_t)),
+        RawDataTag,
+        FieldElemTag
+    >::type;
+
     using FieldLengthTag = typename std::conditional<
         details::ArrayListFieldHasVarLength<ElementType>::Value,
         VarLengthTag,
@@ -704,6 +710,35 @@ private:
         return ErrorStatus::Success;
     }
 
+    template <typename TIter>
+    ErrorStatus writeInternal(TIter& iter, std::size_t len, FieldElemTag) const
+    {
+        return CommonFuncs::writeSequence(*this, iter, len);
+    }
+
+    template <typename TIter>
+    ErrorStatus writeInternal(TIter& iter, std::size_t len, RawDataTag) const
+    {
+        if (len < value_.size()) {
+            return ErrorStatus::BufferOverflow;
+        }
+
+        writeNoStatusInternal(iter, RawDataTag());
+        return ErrorStatus::Success;
+    }
+
+    template <typename TIter>
+    void writeNoStatusInternal(TIter& iter, FieldElemTag) const
+    {
+        CommonFuncs::writeSequenceNoStatus(*this, iter);
+    }
+
+    template <typename TIter>
+    void writeNoStatusInternal(TIter& iter, RawDataTag) const
+    {
+        iter = std::copy_n(value_.begin(), value_.size(), iter);
+    }
+
     template <typename TIter>
     void doAssign(TIter& iter, std::size_t len, AssignExistsTag) {
         value_.assign(iter, iter + len);
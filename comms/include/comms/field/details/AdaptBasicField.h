@@ -769,9 +769,10 @@ class AdaptBasicField
             1U >= FieldsOptionsCompatibilityCalc<
                 ParsedOptions::HasCustomValueReader,
                 ParsedOptions::HasFixedSizeStorage,
+                ParsedOptions::HasSmallBufferStorage,
                 ParsedOptions::HasOrigDataView>::Value,
             "The following options are incompatible, cannot be used together: "
-            "CustomStorageType, FixedSizeStorage, OrigDataView");
+            "CustomStorageType, FixedSizeStorage, SmallBufferStorage, OrigDataView");
 
     static_assert(
             (!ParsedOptions::HasSequenceFixedSizeUseFixedSizeStorage) ||
@@ -784,6 +785,12 @@ class AdaptBasicField
             "The following options are incompatible, cannot be used together: "
             "SequenceFixedSizeUseFixedSizeStorage, FixedSizeStorage");
 
+    static_assert(
+            (!ParsedOptions::HasSequenceFixedSizeUseFixedSizeStorage) ||
+            (!ParsedOptions::HasSmallBufferStorage),
+            "The following options are incompatible, cannot be used together: "
+            "SequenceFixedSizeUseFixedSizeStorage, SmallBufferStorage");
+
     using InvalidByDefaultAdapted = AdaptFieldInvalidByDefaultT<
         TBasic, ParsedOptions>;
     using VersionStorageAdapted = AdaptFieldVersionStorageT<
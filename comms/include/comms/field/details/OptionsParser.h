@@ -64,6 +64,7 @@ public:
     static const bool HasIgnoreInvalid = false;
     static const bool HasInvalidByDefault = false;
     static const bool HasFixedSizeStorage = false;
+    static const bool HasSmallBufferStorage = false;
     static const bool HasCustomStorageType = false;
     static const bool HasScalingRatio = false;
     static const bool HasUnits = false;
@@ -324,6 +325,16 @@ public:
     static const std::size_t FixedSizeStorage = TSize;
 };
 
+template <std::size_t TSize, typename... TOptions>
+class OptionsParser<
+    comms::option::app::SmallBufferStorage<TSize>,
+    TOptions...> : public OptionsParser<TOptions...>
+{
+public:
+    static const bool HasSmallBufferStorage = true;
+    static const std::size_t SmallBufferStorage = TSize;
+};
+
 template <typename TType, typename... TOptions>
 class OptionsParser<
     comms::option::app::CustomStorageType<TType>,
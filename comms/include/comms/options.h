@@ -1137,6 +1137,19 @@ using DefaultVariantIndex = DefaultValueInitialiser<details::DefaultVariantIndex
 /// @headerfile comms/options.h
 struct ChecksumLayerVerifyBeforeRead {};
 
+/// @brief Force comms::protocol::MsgSizeLayer to reject (report
+///     @ref comms::ErrorStatus::ProtocolError) frames, reported size of which
+///     is less than minimal or exceeds maximal serialisation length of all the
+///     known messages (including the transport fields of the wrapped layers).
+/// @details Allows immediate rejection of the malformed frames without waiting for
+///     the reported amount of data to be accumulated and without allocation of
+///     the message object. Should NOT be used when the protocol allows extra
+///     (unknown) data at the end of the message payload or when
+///     @ref comms::option::app::SupportGenericMessage option is used to
+///     handle unknown messages.
+/// @headerfile comms/options.h
+struct MsgSizeLayerVerifyLengthBounds {};
+
 /// @brief Force field not to be serialized during read/write operations
 /// @details Some protocols may define some constant values that are predefined
 ///     and are not present on I/O link when serialized. Sometimes it is convenient
@@ -1332,6 +1345,43 @@ struct NoLengthImpl {};
 /// @headerfile comms/options.h
 struct NoRefreshImpl {};
 
+/// @brief Option that forces generation of separate read and version update
+///     code paths for the listed protocol versions in
+///     @ref comms::MessageBase.
+/// @details Applicable only to messages which have their version in extra
+///     transport fields (see @ref comms::option::def::VersionInExtraTransportFields).
+///     When the reported version is one of the listed, the existence of the
+///     fields marked with @ref comms::option::def::ExistsBetweenVersions
+///     option is resolved at compile time. The missing fields are not
+///     accessed during read operation at all. The version is checked only once
+///     per read operation instead of once per version dependent field.
+///     Other versions are handled using the default (generic) code path.
+/// @tparam TVersions Protocol versions to generate code for.
+/// @headerfile comms/options.h
+template <std::uintmax_t... TVersions>
+struct VersionSpecificImpl {};
+
+/// @brief Option that enables caching of the serialisation length of the
+///     message fields in @ref comms::MessageBase.
+/// @details The length is calculated by @b doLength() once and
+///     reused until any of the fields is accessed for modification via
+///     non-const @ref comms::MessageBase::fields() (used by the
+///     field access functions generated by @ref COMMS_MSG_FIELDS_ACCESS()
+///     as well as by read operation), or until the message is written
+///     or refreshed. Useful for messages
+///     containing lists of variable length elements, for which the
+///     length is requested multiple times when being written by the
+///     protocol stack.
+/// @note The modification of the field via reference kept across
+///     @b length() calls is detected only after the following write
+///     (including partial one) or refresh of the message. Until then
+///     the @b length() returns stale value, which is also used by the protocol
+///     stack (for example by @ref comms::protocol::MsgSizeLayer) when the
+///     message is written, resulting in a corrupted frame. Do not keep such
+///     references or invoke @b refresh() after the modification.
+/// @headerfile comms/options.h
+struct CachedLength {};
+
 /// @brief Option that forces "in place" allocation with placement "new" for
 ///     initialisation, instead of usage of dynamic memory allocation.
 /// @headerfile comms/options.h
@@ -1344,6 +1394,84 @@ struct InPlaceAllocation {};
 template <typename TGenericMessage>
 struct SupportGenericMessage {};
 
+/// @brief Option used to enable recycling of message objects inside
+///     @ref comms::protocol::MsgIdLayer.
+/// @details When used, the layer keeps the most recently released
+///     (see @ref comms::protocol::MsgIdLayer::recycleMsg()) object of every
+///     message type and reuses it (after restoring values of its
+///     fields to the ones of the default constructed message object of
+///     the same type) during the subsequent read of the same message type
+///     instead of allocating a new one.
+/// @note Incompatible with @ref InPlaceAllocation and @ref SupportGenericMessage
+///     options.
+/// @headerfile comms/options.h
+struct MsgRecycling {};
+
+/// @brief Option used to specify maximal number of messages that can be
+///     accumulated in a single batch of @ref comms::protocol::MsgBatchLayer
+///     before it needs to be flushed.
+/// @details When used, the @ref comms::protocol::MsgBatchLayer::Batch::isFlushRequired()
+///     member function reports @b true when the number of accumulated messages
+///     reaches the specified limit.
+/// @tparam TCount Maximal number of messages in a single batch.
+/// @headerfile comms/options.h
+template <std::size_t TCount>
+struct MsgBatchLayerFlushCount {};
+
+/// @brief Option used to specify maximal number of bytes that can be
+///     accumulated in a single batch of @ref comms::protocol::MsgBatchLayer
+///     before it needs to be flushed.
+/// @details When used, the @ref comms::protocol::MsgBatchLayer::Batch::isFlushRequired()
+///     member function reports @b true when the serialisation length of the
+///     accumulated messages reaches or exceeds the specified limit.
+/// @tparam TBytes Number of bytes.
+/// @headerfile comms/options.h
+template <std::size_t TBytes>
+struct MsgBatchLayerFlushBytes {};
+
+/// @brief Option used to specify maximal amount of time the messages
+///     can be accumulated in a single batch of @ref comms::protocol::MsgBatchLayer
+///     before it needs to be flushed.
+/// @details When used, the @ref comms::protocol::MsgBatchLayer::Batch::isFlushRequired()
+///     member function reports @b true when the first message in the batch
+///     was added at least specified number of milliseconds ago. The time is
+///     measured using @b std::chrono::steady_clock.
+/// @tparam TMillisecs Number of milliseconds.
+/// @headerfile comms/options.h
+template <unsigned long long TMillisecs>
+struct MsgBatchLayerFlushTime {};
+
+/// @brief Option used to specify minimal length of the data that
+///     @ref comms::protocol::CompressionLayer attempts to compress.
+/// @details Shorter data is written uncompressed. By default the layer
+///     attempts to compress any data. Note, that the data is always written
+///     uncompressed if the compression doesn't reduce its length.
+/// @tparam TLen Minimal length of the data in bytes.
+/// @headerfile comms/options.h
+template <std::size_t TLen>
+struct CompressionLayerMinLength {};
+
+/// @brief Option used to specify maximal length of the data decompressed by
+///     @ref comms::protocol::CompressionLayer.
+/// @details The read operation fails with comms::ErrorStatus::ProtocolError
+///     when the decompressed data exceeds the specified length. By default
+///     the decompressed data is limited to 65535 bytes.
+/// @tparam TLen Maximal length of the decompressed data in bytes.
+/// @headerfile comms/options.h
+template <std::size_t TLen>
+struct CompressionLayerMaxLength {};
+
+/// @brief Option used to force periodic transmission of full message
+///     (keyframe) by @ref comms::protocol::DeltaLayer.
+/// @details By default, the layer writes full message only when there
+///     is no previously written message of the same type. When this option
+///     is used, every @b TInterval-th message of the same type is written
+///     in full, allowing the other side to resynchronise.
+/// @tparam TInterval Keyframe interval, must be greater than 0.
+/// @headerfile comms/options.h
+template <std::size_t TInterval>
+struct DeltaLayerKeyframeInterval {};
+
 /// @brief Option that forces usage of embedded uninitialised data area instead
 ///     of dynamic memory allocation.
 /// @details Applicable to fields that represent collection of raw data or other
@@ -1360,6 +1488,21 @@ struct SupportGenericMessage {};
 template <std::size_t TSize>
 struct FixedSizeStorage {};
 
+/// @brief Option that forces usage of embedded storage area for small amount
+///     of data with fallback to dynamic memory allocation for larger one.
+/// @details Applicable to fields that represent collection of raw data or other
+///     fields, such as comms::field::ArrayList or comms::field::String. If this
+///     option is used, it will force such fields to use @ref comms::util::SmallVector
+///     or @ref comms::util::SmallString as their internal data storage. Up to
+///     @b TSize elements are stored without any dynamic memory allocation, while
+///     longer sequences are moved to the heap. Unlike @ref FixedSizeStorage, there
+///     is no upper limit on the amount of stored elements.
+/// @tparam TSize Size of the embedded storage area in number of elements, for
+///     strings it does @b NOT include the '\0' terminating character.
+/// @headerfile comms/options.h
+template <std::size_t TSize>
+struct SmallBufferStorage {};
+
 /// @brief Set custom storage type for fields like comms::field::String or
 ///     comms::field::ArrayList.
 /// @details By default comms::field::String uses
@@ -1398,7 +1541,8 @@ struct NoVirtualDestructor {};
 /// @note The original data must be preserved until destruction of the field
 ///     that uses the "view".
 /// @note Incompatible with other options that contol data storage type,
-///     such as @ref comms::option::CustomStorageType or @ref comms::option::FixedSizeStorage
+///     such as @ref comms::option::CustomStorageType, @ref comms::option::FixedSizeStorage
+///     or @ref comms::option::SmallBufferStorage
 /// @headerfile comms/options.h
 struct OrigDataView {};
 
@@ -1419,6 +1563,57 @@ using ForceDispatchStaticBinSearch = ForceDispatch<comms::traits::dispatch::Stat
 ///     message object and/or message object type
 using ForceDispatchLinearSwitch = ForceDispatch<comms::traits::dispatch::LinearSwitch>;
 
+/// @brief Option for the message interface class (@ref comms::Message) to
+///     enable hot-path instrumentation hooks.
+/// @details When used, the @ref comms::protocol::ProtocolLayerBase::read() "read()"
+///     and @ref comms::protocol::ProtocolLayerBase::write() "write()" of every
+///     protocol layer, the message object creation by the @ref comms::protocol::MsgIdLayer,
+///     and the fields read of the @ref comms::MessageBase report begin and end of
+///     the operation to the provided policy class. When the option is not used
+///     there are no calls to any hooks and no extra code generated.
+///     The policy class is expected to define the following static member
+///     functions (see @ref comms::util::RdtscInstrumentation for a ready-made one):
+///     @code
+///     struct MyInstrumentation
+///     {
+///         // Beginning of the read / write of the protocol layer, the returned
+///         // value (of any copyable type) is passed to the matching end function.
+///         template <typename TLayer>
+///         static Stamp layerReadBegin();
+///
+///         template <typename TLayer>
+///         static Stamp layerWriteBegin();
+///
+///         // End of the read / write of the protocol layer, "msg" is the parameter
+///         // passed to the read() / write() (smart pointer or message object).
+///         template <typename TLayer, typename TMsg>
+///         static void layerReadEnd(Stamp start, const TMsg& msg, std::size_t consumed, comms::ErrorStatus es);
+///
+///         template <typename TLayer, typename TMsg>
+///         static void layerWriteEnd(Stamp start, const TMsg& msg, std::size_t written, comms::ErrorStatus es);
+///
+///         // Creation of the message object by the comms::protocol::MsgIdLayer
+///         template <typename TLayer, typename TId>
+///         static Stamp msgCreateBegin(const TId& id);
+///
+///         template <typename TLayer, typename TId>
+///         static void msgCreateEnd(Stamp start, const TId& id, bool created);
+///
+///         // Read of the message fields, TMsg is the message type.
+///         template <typename TMsg>
+///         static Stamp msgReadBegin();
+///
+///         template <typename TMsg>
+///         static void msgReadEnd(Stamp start, const TMsg& msg, std::size_t consumed, comms::ErrorStatus es);
+///     };
+///     @endcode
+///     The number of written bytes is reported only for random access
+///     output iterators, it is reported as 0 otherwise.
+/// @tparam T Instrumentation policy class.
+/// @headerfile comms/options.h
+template <typename T>
+struct Instrumentation {};
+
 } // namespace app
 
 // Definition options
@@ -1745,6 +1940,9 @@ using DefaultVariantIndex = comms::option::def::DefaultVariantIndex<TIdx>;
 /// @brief Same as @ref comms::option::def::ChecksumLayerVerifyBeforeRead
 using ChecksumLayerVerifyBeforeRead = comms::option::def::ChecksumLayerVerifyBeforeRead;
 
+/// @brief Same as @ref comms::option::def::MsgSizeLayerVerifyLengthBounds
+using MsgSizeLayerVerifyLengthBounds = comms::option::def::MsgSizeLayerVerifyLengthBounds;
+
 /// @brief Same as @ref comms::option::def::EmptySerialization
 using EmptySerialization = comms::option::def::EmptySerialization;
 
@@ -1858,6 +2056,13 @@ using NoLengthImpl = comms::option::app::NoLengthImpl;
 /// @brief Same as @ref comms::option::app::NoRefreshImpl
 using NoRefreshImpl = comms::option::app::NoRefreshImpl;
 
+/// @brief Same as @ref comms::option::app::VersionSpecificImpl
+template <std::uintmax_t... TVersions>
+using VersionSpecificImpl = comms::option::app::VersionSpecificImpl<TVersions...>;
+
+/// @brief Same as @ref comms::option::app::CachedLength
+using CachedLength = comms::option::app::CachedLength;
+
 /// @brief Same as @ref comms::option::app::InPlaceAllocation
 using InPlaceAllocation = comms::option::app::InPlaceAllocation;
 
@@ -1865,10 +2070,41 @@ using InPlaceAllocation = comms::option::app::InPlaceAllocation;
 template <typename TGenericMessage>
 using SupportGenericMessage = comms::option::app::SupportGenericMessage<TGenericMessage>;
 
+/// @brief Same as @ref comms::option::app::MsgRecycling
+using MsgRecycling = comms::option::app::MsgRecycling;
+
+/// @brief Same as @ref comms::option::app::MsgBatchLayerFlushCount
+template <std::size_t TCount>
+using MsgBatchLayerFlushCount = comms::option::app::MsgBatchLayerFlushCount<TCount>;
+
+/// @brief Same as @ref comms::option::app::MsgBatchLayerFlushBytes
+template <std::size_t TBytes>
+using MsgBatchLayerFlushBytes = comms::option::app::MsgBatchLayerFlushBytes<TBytes>;
+
+/// @brief Same as @ref comms::option::app::MsgBatchLayerFlushTime
+template <unsigned long long TMillisecs>
+using MsgBatchLayerFlushTime = comms::option::app::MsgBatchLayerFlushTime<TMillisecs>;
+
+/// @brief Same as @ref comms::option::app::CompressionLayerMinLength
+template <std::size_t TLen>
+using CompressionLayerMinLength = comms::option::app::CompressionLayerMinLength<TLen>;
+
+/// @brief Same as @ref comms::option::app::CompressionLayerMaxLength
+template <std::size_t TLen>
+using CompressionLayerMaxLength = comms::option::app::CompressionLayerMaxLength<TLen>;
+
+/// @brief Same as @ref comms::option::app::DeltaLayerKeyframeInterval
+template <std::size_t TInterval>
+using DeltaLayerKeyframeInterval = comms::option::app::DeltaLayerKeyframeInterval<TInterval>;
+
 /// @brief Same as @ref comms::option::app::FixedSizeStorage
 template <std::size_t TSize>
 using FixedSizeStorage = comms::option::app::FixedSizeStorage<TSize>;
 
+/// @brief Same as @ref comms::option::app::SmallBufferStorage
+template <std::size_t TSize>
+using SmallBufferStorage = comms::option::app::SmallBufferStorage<TSize>;
+
 /// @brief Same as @ref comms::option::app::CustomStorageType
 template <typename TType>
 using CustomStorageType = comms::option::app::CustomStorageType<TType>;
@@ -1895,6 +2131,10 @@ using ForceDispatchStaticBinSearch = comms::option::app::ForceDispatchStaticBinS
 /// @brief Same as @ref comms::option::app::ForceDispatchLinearSwitch
 using ForceDispatchLinearSwitch = comms::option::app::ForceDispatchLinearSwitch;
 
+/// @brief Same as @ref comms::option::app::Instrumentation
+template <typename T>
+using Instrumentation = comms::option::app::Instrumentation<T>;
+
 }  // namespace option
 
 }  // namespace comms
@@ -22,6 +22,8 @@
 
 #include <type_traits>
 #include <iterator>
+#include <chrono>
+#include <limits>
 
 #include "comms/ErrorStatus.h"
 #include "comms/iterator.h"
@@ -40,6 +42,9 @@ namespace  comms
 /// @brief Process input until first message is recognized and its object is created
 ///     or missing data is reported.
 /// @details Can be used to implement @ref page_use_prot_transport_read.
+///     If the protocol frame holds messages left from the previously
+///     read batch (see @ref comms::protocol::MsgBatchLayer), the next such message
+///     is returned without consuming any input.
 /// @param[in, out] bufIter Iterator to input buffer. Passed by reference and is updated
 ///     when buffer is iterated over. Number of consumed bytes cat be determined by
 ///     calculating the distance between originally passed value and the one after
@@ -66,6 +71,11 @@ comms::ErrorStatus processSingle(
     TMsg& msg,
     TExtraValues... extraValues)
 {
+    if (details::ProcessFrameReader::takePendingMsg(frame, msg, extraValues...)) {
+        // Message left from previously read batch (see comms::protocol::MsgBatchLayer)
+        return comms::ErrorStatus::Success;
+    }
+
     std::size_t consumed = 0U;
     auto onExit =
         comms::util::makeScopeGuard(
@@ -80,7 +90,7 @@ comms::ErrorStatus processSingle(
         auto iter = begIter;
 
         // Do the read
-        auto es = frame.read(msg, iter, len - consumed, extraValues...);
+        auto es = details::ProcessFrameReader::read(frame, msg, iter, len - consumed, extraValues...);
         if (es == comms::ErrorStatus::NotEnoughData) {
             return es;
         }
@@ -88,10 +98,12 @@ comms::ErrorStatus processSingle(
         if (es == comms::ErrorStatus::ProtocolError) {
             // Something is not right with the data, remove one character and try again
            ++consumed;
+            comms::protocol::details::ReadStatisticsReporter::resyncBytes(1U, extraValues...);
             continue;
         }
 
         consumed += std::distance(begIter, iter);
+        comms::protocol::details::ReadStatisticsReporter::status(es, extraValues...);
         return es;
     }
 
@@ -233,7 +245,8 @@ comms::ErrorStatus processSingleWithDispatchViaDispatcher(
 /// @brief Process all available input and dispatch all created message objects
 ///     to appropriate handling function.
 /// @details All the created message objects are immediatelly destructed after
-///     dispatching.
+///     dispatching, or released using @b recycleMsg() member function of the
+///     frame when @ref comms::option::app::MsgRecycling option is used.
 /// @param[in, out] bufIter Iterator to input buffer. Passed by value and is @b NOT updated
 ///     when buffer is iterated over (unlike @ref comms::processSingle(),
 ///     @ref comms::processSingleWithDispatch(), @ref comms::processSingleWithDispatchViaDispatcher()).
@@ -242,6 +255,9 @@ comms::ErrorStatus processSingleWithDispatchViaDispatcher(
 ///     is used to process the raw input.
 /// @param[in] handler Handler to handle message object when dispatched. The dispatch
 ///     is performed using @ref comms::dispatchMsg() function.
+/// @param[in, out] extraValues Extra values that are passed as variadic parameters to
+///     @ref comms::protocol::ProtocolLayerBase::read() "read()" member function
+///     of the protocol frame / stack, such as @ref comms::protocol::readStatistics().
 /// @return Number of consumed bytes from the buffer. The caller is responsible to
 ///     remove them from the buffer.
 /// @note Defined in comms/process.h
@@ -257,17 +273,19 @@ std::size_t processAllWithDispatch(
     TBufIter bufIter,
     std::size_t len,
     TFrame&& frame,
-    THandler& handler)
+    THandler& handler,
+    TExtraValues... extraValues)
 {
     std::size_t consumed = 0U;
     using FrameType = typename std::decay<decltype(frame)>::type;
     using MsgPtr = typename FrameType::MsgPtr;
-    while (consumed < len) {
+    while ((consumed < len) || frame.hasPendingMsg()) {
         auto begIter = bufIter + consumed;
         auto iter = begIter;
 
         MsgPtr msg;
-        auto es = processSingleWithDispatch(iter, len - consumed, std::forward<TFrame>(frame), msg, handler);
+        auto es = processSingleWithDispatch(iter, len - consumed, std::forward<TFrame>(frame), msg, handler, extraValues...);
+        details::ProcessMsgRecycler::recycle(frame, msg);
         consumed += std::distance(begIter, iter);
         if (es == comms::ErrorStatus::NotEnoughData) {
             break;
@@ -295,6 +313,9 @@ std::size_t processAllWithDispatch(
 ///     is used to process the raw input.
 /// @param[in] handler Handler to handle message object when dispatched. The dispatch
 ///     is performed via provded @b TDispatcher class (see @ref comms::MsgDispatcher).
+/// @param[in, out] extraValues Extra values that are passed as variadic parameters to
+///     @ref comms::protocol::ProtocolLayerBase::read() "read()" member function
+///     of the protocol frame / stack, such as @ref comms::protocol::readStatistics().
 /// @return Number of consumed bytes from the buffer. The caller is responsible to
 ///     remove them from the buffer.
 /// @note Defined in comms/process.h
@@ -306,17 +327,19 @@ std::size_t processAllWithDispatchViaDispatcher(
     TBufIter bufIter,
     std::size_t len,
     TFrame&& frame,
-    THandler& handler)
+    THandler& handler,
+    TExtraValues... extraValues)
 {
     std::size_t consumed = 0U;
     using FrameType = typename std::decay<decltype(frame)>::type;
     using MsgPtr = typename FrameType::MsgPtr;
-    while (consumed < len) {
+    while ((consumed < len) || frame.hasPendingMsg()) {
         auto begIter = bufIter + consumed;
         auto iter = begIter;
 
         MsgPtr msg;
-        auto es = processSingleWithDispatchViaDispatcher<TDispatcher>(iter, len - consumed, std::forward<TFrame>(frame), msg, handler);
+        auto es = processSingleWithDispatchViaDispatcher<TDispatcher>(iter, len - consumed, std::forward<TFrame>(frame), msg, handler, extraValues...);
+        details::ProcessMsgRecycler::recycle(frame, msg);
         consumed += std::distance(begIter, iter);
         if (es == comms::ErrorStatus::NotEnoughData) {
             break;
@@ -327,4 +350,214 @@ std::size_t processAllWithDispatchViaDispatcher(
     return consumed;
 }
 
+/// @brief Limits of the work performed by the budgeted processing functions.
+/// @details Used by @ref comms::processAllWithDispatchBudgeted() and
+///     @ref comms::processAllWithDispatchViaDispatcherBudgeted().
+///     By default no limits are set. Any combination of maximum number of
+///     messages, maximum number of bytes and deadline can be specified.
+///     The limits are checked before processing of every message, i.e.
+///     every started message is processed completely, and the number of
+///     consumed bytes may exceed the specified maximum by the length of the last message.
+///     @code
+///     comms::ProcessBudget<> budget;
+///     budget.setMaxMessages(100);
+///     budget.setDeadline(std::chrono::steady_clock::now() + std::chrono::milliseconds(1));
+///     @endcode
+/// @tparam TClock Clock type used to check the deadline.
+/// @headerfile comms/process.h
+template <typename TClock = std::chrono::steady_clock>
+class ProcessBudget
+{
+public:
+    /// @brief Type of the clock
+    using Clock = TClock;
+
+    /// @brief Type of the time point
+    using TimePoint = typename Clock::time_point;
+
+    /// @brief Set maximum number of dispatched messages.
+    void setMaxMessages(std::size_t value)
+    {
+        maxMessages_ = value;
+    }
+
+    /// @brief Get maximum number of dispatched messages.
+    std::size_t getMaxMessages() const
+    {
+        return maxMessages_;
+    }
+
+    /// @brief Set maximum number of consumed bytes.
+    void setMaxBytes(std::size_t value)
+    {
+        maxBytes_ = value;
+    }
+
+    /// @brief Get maximum number of consumed bytes.
+    std::size_t getMaxBytes() const
+    {
+        return maxBytes_;
+    }
+
+    /// @brief Set deadline.
+    void setDeadline(TimePoint value)
+    {
+        deadline_ = value;
+        hasDeadline_ = true;
+    }
+
+    /// @brief Remove previously set deadline.
+    void clearDeadline()
+    {
+        hasDeadline_ = false;
+    }
+
+    /// @brief Check whether the budget has been exhausted.
+    /// @param[in] messages Number of already dispatched messages.
+    /// @param[in] bytes Number of already consumed bytes.
+    bool isExhausted(std::size_t messages, std::size_t bytes) const
+    {
+        return
+            (maxMessages_ <= messages) ||
+            (maxBytes_ <= bytes) ||
+            (hasDeadline_ && (deadline_ <= Clock::now()));
+    }
+
+private:
+    std::size_t maxMessages_ = std::numeric_limits<std::size_t>::max();
+    std::size_t maxBytes_ = std::numeric_limits<std::size_t>::max();
+    TimePoint deadline_ = TimePoint();
+    bool hasDeadline_ = false;
+};
+
+/// @brief Result of the budgeted processing functions.
+/// @details Returned by @ref comms::processAllWithDispatchBudgeted() and
+///     @ref comms::processAllWithDispatchViaDispatcherBudgeted().
+/// @headerfile comms/process.h
+struct ProcessBudgetResult
+{
+    std::size_t consumed = 0U; ///< Number of consumed bytes, which the caller needs to remove from the buffer
+    std::size_t messages = 0U; ///< Number of dispatched messages
+    bool exhausted = false; ///< The budget has been exhausted before all the available input was processed
+};
+
+/// @brief Process available input within provided budget and dispatch all
+///     created message objects to appropriate handling function.
+/// @details Similar to @ref comms::processAllWithDispatch(), but stops when
+///     the provided budget (see @ref comms::ProcessBudget) is exhausted.
+///     The processing can be resumed later by calling the function again
+///     with the buffer from which consumed bytes have been removed. Any
+///     unprocessed data (including incomplete frame and messages pending
+///     in the protocol stack) is left for the next call.
+/// @param[in] bufIter Iterator to input buffer. Passed by value and is @b NOT updated
+///     when buffer is iterated over.
+/// @param[in] len Number of remaining bytes in input buffer.
+/// @param[in] frame Protocol frame / stack (see @ref page_use_prot_transport) that
+///     is used to process the raw input.
+/// @param[in] handler Handler to handle message object when dispatched. The dispatch
+///     is performed using @ref comms::dispatchMsg() function.
+/// @param[in] budget Processing budget, usually a variant of @ref comms::ProcessBudget.
+/// @param[in, out] extraValues Extra values that are passed as variadic parameters to
+///     @ref comms::protocol::ProtocolLayerBase::read() "read()" member function
+///     of the protocol frame / stack.
+/// @return Information on how far the processing got.
+/// @note Defined in comms/process.h
+/// @see @ref comms::processAllWithDispatch().
+/// @see @ref page_use_prot_transport_read
+template <typename TBufIter, typename TFrame, typename THandler, typename TBudget, typename... TExtraValues>
+ProcessBudgetResult processAllWithDispatchBudgeted(
+    TBufIter bufIter,
+    std::size_t len,
+    TFrame&& frame,
+    THandler& handler,
+    const TBudget& budget,
+    TExtraValues... extraValues)
+{
+    ProcessBudgetResult result;
+    using FrameType = typename std::decay<decltype(frame)>::type;
+    using MsgPtr = typename FrameType::MsgPtr;
+    while ((result.consumed < len) || frame.hasPendingMsg()) {
+        if (budget.isExhausted(result.messages, result.consumed)) {
+            result.exhausted = true;
+            break;
+        }
+
+        auto begIter = bufIter + result.consumed;
+        auto iter = begIter;
+
+        MsgPtr msg;
+        auto es = processSingleWithDispatch(iter, len - result.consumed, std::forward<TFrame>(frame), msg, handler, extraValues...);
+        details::ProcessMsgRecycler::recycle(frame, msg);
+        result.consumed += std::distance(begIter, iter);
+        if (es == comms::ErrorStatus::NotEnoughData) {
+            break;
+        }
+
+        if (es == comms::ErrorStatus::Success) {
+            ++result.messages;
+        }
+        COMMS_ASSERT(result.consumed <= len);
+    }
+
+    return result;
+}
+
+/// @brief Process available input within provided budget and dispatch all
+///     created message objects to appropriate handling function.
+/// @details Similar to @ref comms::processAllWithDispatchBudgeted(), but allows forcing
+///     a particular dispatch policy.
+/// @tparam TDispatcher A variant of @ref comms::MsgDispatcher class.
+/// @param[in] bufIter Iterator to input buffer. Passed by value and is @b NOT updated
+///     when buffer is iterated over.
+/// @param[in] len Number of remaining bytes in input buffer.
+/// @param[in] frame Protocol frame / stack (see @ref page_use_prot_transport) that
+///     is used to process the raw input.
+/// @param[in] handler Handler to handle message object when dispatched. The dispatch
+///     is performed via provded @b TDispatcher class (see @ref comms::MsgDispatcher).
+/// @param[in] budget Processing budget, usually a variant of @ref comms::ProcessBudget.
+/// @param[in, out] extraValues Extra values that are passed as variadic parameters to
+///     @ref comms::protocol::ProtocolLayerBase::read() "read()" member function
+///     of the protocol frame / stack.
+/// @return Information on how far the processing got.
+/// @note Defined in comms/process.h
+/// @see @ref comms::processAllWithDispatchViaDispatcher().
+/// @see @ref page_use_prot_transport_read
+template <typename TDispatcher, typename TBufIter, typename TFrame, typename THandler, typename TBudget, typename... TExtraValues>
+ProcessBudgetResult processAllWithDispatchViaDispatcherBudgeted(
+    TBufIter bufIter,
+    std::size_t len,
+    TFrame&& frame,
+    THandler& handler,
+    const TBudget& budget,
+    TExtraValues... extraValues)
+{
+    ProcessBudgetResult result;
+    using FrameType = typename std::decay<decltype(frame)>::type;
+    using MsgPtr = typename FrameType::MsgPtr;
+    while ((result.consumed < len) || frame.hasPendingMsg()) {
+        if (budget.isExhausted(result.messages, result.consumed)) {
+            result.exhausted = true;
+            break;
+        }
+
+        auto begIter = bufIter + result.consumed;
+        auto iter = begIter;
+
+        MsgPtr msg;
+        auto es = processSingleWithDispatchViaDispatcher<TDispatcher>(iter, len - result.consumed, std::forward<TFrame>(frame), msg, handler, extraValues...);
+        details::ProcessMsgRecycler::recycle(frame, msg);
+        result.consumed += std::distance(begIter, iter);
+        if (es == comms::ErrorStatus::NotEnoughData) {
+            break;
+        }
+
+        if (es == comms::ErrorStatus::Success) {
+            ++result.messages;
+        }
+        COMMS_ASSERT(result.consumed <= len);
+    }
+
+    return result;
+}
+
 } // namespace  comms
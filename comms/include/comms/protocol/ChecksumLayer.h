@@ -264,6 +264,7 @@ private:
 
         if (expectedValue != static_cast<decltype(expectedValue)>(checksum)) {
             BaseImpl::resetMsg(msg);
+            BaseImpl::reportChecksumFailure(extraValues...);
             return ErrorStatus::ProtocolError;
         }
 
@@ -310,6 +311,7 @@ private:
 
         if (expectedValue != static_cast<decltype(expectedValue)>(checksum)) {
             BaseImpl::resetMsg(msg);
+            BaseImpl::reportChecksumFailure(extraValues...);
             return ErrorStatus::ProtocolError;
         }
 
@@ -276,6 +276,7 @@ private:
 
         if (expectedValue != static_cast<decltype(expectedValue)>(checksum)) {
             BaseImpl::resetMsg(msg);
+            BaseImpl::reportChecksumFailure(extraValues...);
             return ErrorStatus::ProtocolError;
         }
 
@@ -305,6 +306,7 @@ private:
 
         if (expectedValue != static_cast<decltype(expectedValue)>(checksum)) {
             BaseImpl::resetMsg(msg);
+            BaseImpl::reportChecksumFailure(extraValues...);
             return ErrorStatus::ProtocolError;
         }
 
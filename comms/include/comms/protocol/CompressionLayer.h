@@ -0,0 +1,543 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+#include <algorithm>
+
+#include "comms/ErrorStatus.h"
+#include "comms/Assert.h"
+#include "comms/field/IntValue.h"
+#include "comms/protocol/ProtocolLayerBase.h"
+#include "comms/protocol/details/CompressionLayerOptionsParser.h"
+#include "comms/protocol/details/NextLayerBufferWriter.h"
+#include "comms/protocol/details/ProtocolLayerExtendingClassHelper.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+/// @brief Protocol layer that compresses the data written by the wrapped
+///     internal layers and decompresses it during the read.
+/// @details The layer writes a flag field, which indicates whether the data
+///     that follows is compressed, and then the data itself. The compressed
+///     data is expected to occupy the rest of the frame, i.e. the layer is
+///     expected to be wrapped by @ref comms::protocol::MsgSizeLayer or
+///     the frame must be otherwise delimited.@n
+///     During the write operation the wrapped layers write their data into
+///     the temporary buffer, which is then compressed. The data is written
+///     uncompressed when it is shorter than the value specified by
+///     @ref comms::option::app::CompressionLayerMinLength option or when
+///     the compression doesn't reduce its length. The result of the last
+///     compression is cached inside the layer, as the result the
+///     @ref length() calculation followed by the write of the same message
+///     (performed by wrapping @ref comms::protocol::MsgSizeLayer) serialises
+///     and compresses the data only once. The @ref length() calculation
+///     performed outside the write operation doesn't modify the state of
+///     the stateful next layers (such as @ref comms::protocol::DeltaLayer).@n
+///     During the read operation the compressed data is decompressed into
+///     the internal buffer of the layer and the read operation is forwarded
+///     to the next layer on that buffer. The decompressed data is limited
+///     by @ref comms::option::app::CompressionLayerMaxLength option. Note, that the fields that keep
+///     a view of the original input data (see @ref comms::option::app::OrigDataView)
+///     as well as the payload location reported via @ref comms::protocol::msgPayload()
+///     refer to the internal buffer, which remains valid until the next
+///     read operation.
+/// @tparam TField Type of the flag field. Its zero value indicates uncompressed data.
+/// @tparam TCodec Compression codec class, such as @ref comms::protocol::compression::Lz77.
+///     It must be default constructible and define the following member
+///     functions:
+///     @code
+///     template <typename TOutput>
+///     comms::ErrorStatus compress(const std::uint8_t* data, std::size_t len, TOutput& out) const;
+///
+///     template <typename TOutput>
+///     comms::ErrorStatus decompress(const std::uint8_t* data, std::size_t len, TOutput& out, std::size_t maxLen) const;
+///     @endcode
+///     Both functions are expected to append their output to the
+///     @b std::vector<std::uint8_t> passed as @b out parameter. The
+///     decompression is expected to fail when its output exceeds @b maxLen bytes.
+/// @tparam TNextLayer Next transport layer in protocol stack.
+/// @tparam TOptions Default functionality extension options. Supported options are:
+///     @li  @ref comms::option::def::ExtendingClass - Use this option to provide a class
+///         name of the extending class, which can be used to extend existing functionality.
+///     @li @ref comms::option::app::CompressionLayerMinLength - Minimal length
+///         of the data to compress.
+///     @li @ref comms::option::app::CompressionLayerMaxLength - Maximal length
+///         of the decompressed data.
+/// @note The read of the compressed data requires the read iterator to be a
+///     pointer to a single byte type (such as <b>const std::uint8_t*</b>).
+/// @headerfile comms/protocol/CompressionLayer.h
+template <typename TField, typename TCodec, typename TNextLayer, typename... TOptions>
+class CompressionLayer : public
+        ProtocolLayerBase<
+            TField,
+            TNextLayer,
+            details::ProtocolLayerExtendingClassT<
+                CompressionLayer<TField, TCodec, TNextLayer, TOptions...>,
+                details::CompressionLayerOptionsParser<TOptions...>
+            >,
+            comms::option::ProtocolLayerDisallowReadUntilDataSplit
+        >
+{
+    using ExtendingClass =
+            details::ProtocolLayerExtendingClassT<
+                CompressionLayer<TField, TCodec, TNextLayer, TOptions...>,
+                details::CompressionLayerOptionsParser<TOptions...>
+            >;
+
+    using BaseImpl =
+        ProtocolLayerBase<
+            TField,
+            TNextLayer,
+            ExtendingClass,
+            comms::option::ProtocolLayerDisallowReadUntilDataSplit
+        >;
+
+    using ParsedOptionsInternal = details::CompressionLayerOptionsParser<TOptions...>;
+
+public:
+    /// @brief Parsed options
+    using ParsedOptions = ParsedOptionsInternal;
+
+    /// @brief Type of the field object used to read/write compression flag.
+    using Field = typename BaseImpl::Field;
+
+    /// @brief Type of the compression codec.
+    using Codec = TCodec;
+
+    /// @brief Default constructor
+    explicit CompressionLayer() = default;
+
+    /// @brief Copy constructor
+    CompressionLayer(const CompressionLayer&) = default;
+
+    /// @brief Move constructor
+    CompressionLayer(CompressionLayer&&) = default;
+
+    /// @brief Destructor.
+    ~CompressionLayer() noexcept = default;
+
+    /// @brief Copy assignment.
+    CompressionLayer& operator=(const CompressionLayer&) = default;
+
+    /// @brief Move assignment.
+    CompressionLayer& operator=(CompressionLayer&&) = default;
+
+    /// @brief Get remaining length of wrapping transport information + length
+    ///     of the provided message.
+    /// @details The actual length is known only after compression, as the
+    ///     result this function serialises and compresses the message.
+    ///     When invoked during the write of the frame (for example by
+    ///     the wrapping @ref comms::protocol::MsgSizeLayer), the produced
+    ///     data is reused by the following @ref doWrite() of the same message
+    ///     without serialising it again. When invoked outside the write
+    ///     operation, the serialisation is wrapped by
+    ///     @ref beginFrameWrite() / @ref endFrameWrite() calls reporting
+    ///     failure, i.e. the state of the stateful next layers
+    ///     (such as @ref comms::protocol::DeltaLayer) is not affected.
+    /// @param[in] msg Message object.
+    template <typename TMsg>
+    std::size_t length(const TMsg& msg) const
+    {
+        if (measuredMsg_ == &msg) {
+            return flagFieldLength(measuredCompressed_) + measuredData().size();
+        }
+
+        using Storage = WriteStorage<TMsg>;
+        Storage data;
+        bool useCompressed = false;
+        if (writeDepth_ == 0U) {
+            BaseImpl::beginFrameWrite();
+            auto es = encode(msg, data, useCompressed);
+            static_cast<void>(es);
+            COMMS_ASSERT(es == comms::ErrorStatus::Success);
+            BaseImpl::endFrameWrite(comms::ErrorStatus::NotSupported);
+            auto dataLen = useCompressed ? cachedOutput_.size() : data.size();
+            return flagFieldLength(useCompressed) + dataLen;
+        }
+
+        auto es = encode(msg, data, useCompressed);
+        static_cast<void>(es);
+        COMMS_ASSERT(es == comms::ErrorStatus::Success);
+        rememberMeasured(msg, data, useCompressed);
+        return flagFieldLength(useCompressed) + measuredData().size();
+    }
+
+    /// @cond SKIP_DOC
+    using BaseImpl::length;
+    /// @endcond
+
+    /// @brief Customized read functionality, invoked by @ref read().
+    /// @details Reads the flag field. If the data is not compressed,
+    ///     the read operation is forwarded to the next layer as is. Otherwise
+    ///     the rest of the input data is decompressed into the internal
+    ///     buffer and the read operation is forwarded to the next layer
+    ///     on that buffer.
+    /// @tparam TMsg Type of @b msg parameter.
+    /// @tparam TIter Type of iterator used for reading.
+    /// @tparam TNextLayerReader next layer reader object type.
+    /// @param[out] field Field object to read.
+    /// @param[in, out] msg Reference to smart pointer, that already holds or
+    ///     will hold allocated message object, or reference to actual message
+    ///     object (which extends @ref comms::MessageBase).
+    /// @param[in, out] iter Input iterator used for reading.
+    /// @param[in] size Size of the data in the sequence
+    /// @param[in] nextLayerReader Reader object, needs to be invoked to
+    ///     forward read operation to the next layer.
+    /// @param[out] extraValues Variadic extra output parameters passed to the
+    ///     "read" operatation of the protocol stack (see
+    ///     @ref comms::protocol::ProtocolLayerBase::read() "read()" and
+    ///     @ref comms::protocol::ProtocolLayerBase::readFieldsCached() "readFieldsCached()").
+    ///     Need to passed on as variadic arguments to the @b nextLayerReader.
+    /// @return Status of the read operation. The comms::ErrorStatus::ProtocolError
+    ///     is returned when the compressed data is malformed or doesn't contain
+    ///     the whole message.
+    /// @pre Iterator must be valid and can be dereferenced and incremented at
+    ///      least "size" times;
+    /// @post The iterator will be advanced by the number of bytes was actually
+    ///       read. In case of an error, distance between original position and
+    ///       advanced will pinpoint the location of the error.
+    template <typename TMsg, typename TIter, typename TNextLayerReader, typename... TExtraValues>
+    comms::ErrorStatus doRead(
+        Field& field,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerReader&& nextLayerReader,
+        TExtraValues... extraValues)
+    {
+        auto es = field.read(iter, size);
+        if (es == ErrorStatus::NotEnoughData) {
+            BaseImpl::updateMissingSize(field, size, extraValues...);
+        }
+
+        if (es != ErrorStatus::Success) {
+            return es;
+        }
+
+        auto remSize = size - field.length();
+        if (!static_cast<ExtendingClass*>(this)->isCompressedFromField(field)) {
+            return nextLayerReader.read(msg, iter, remSize, extraValues...);
+        }
+
+        return readCompressed(msg, iter, remSize, std::forward<TNextLayerReader>(nextLayerReader), extraValues...);
+    }
+
+    /// @brief Customized write functionality, invoked by @ref write().
+    /// @details Serialises the message using next layer(s) into the temporary
+    ///     buffer, compresses it when appropriate, then writes the flag field
+    ///     followed by either compressed or original data.
+    /// @tparam TMsg Type of message object.
+    /// @tparam TIter Type of iterator used for writing.
+    /// @tparam TNextLayerWriter next layer writer object type.
+    /// @param[out] field Field object to update and write.
+    /// @param[in] msg Reference to message object
+    /// @param[in, out] iter Output iterator.
+    /// @param[in] size Max number of bytes that can be written.
+    /// @param[in] nextLayerWriter Next layer writer object.
+    /// @return Status of the write operation.
+    /// @pre Iterator must be valid and can be dereferenced and incremented at
+    ///      least "size" times;
+    /// @post The iterator will be advanced by the number of bytes was actually
+    ///       written. In case of an error, distance between original position
+    ///       and advanced will pinpoint the location of the error.
+    template <typename TMsg, typename TIter, typename TNextLayerWriter>
+    comms::ErrorStatus doWrite(
+        Field& field,
+        const TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerWriter&& nextLayerWriter) const
+    {
+        static_cast<void>(nextLayerWriter);
+        if (measuredMsg_ != &msg) {
+            using Storage = WriteStorage<TMsg>;
+            Storage data;
+            bool useCompressed = false;
+            auto es = encode(msg, data, useCompressed);
+            if (es != ErrorStatus::Success) {
+                return es;
+            }
+
+            rememberMeasured(msg, data, useCompressed);
+        }
+
+        measuredMsg_ = nullptr;
+        static_cast<const ExtendingClass*>(this)->prepareFieldForWrite(measuredCompressed_, field);
+        auto es = field.write(iter, size);
+        if (es != ErrorStatus::Success) {
+            return es;
+        }
+
+        COMMS_ASSERT(field.length() <= size);
+        auto remSize = size - field.length();
+        return writeData(measuredData(), iter, remSize);
+    }
+
+    /// @brief Notify the layer about the beginning of the write operation.
+    /// @details Hides and overrides the
+    ///     @ref comms::protocol::ProtocolLayerBase::beginFrameWrite() "default implementation".
+    ///     Tracks the nesting of the write operations.
+    void beginFrameWrite() const
+    {
+        ++writeDepth_;
+        BaseImpl::beginFrameWrite();
+    }
+
+    /// @brief Notify the layer about the end of the write operation.
+    /// @details Hides and overrides the
+    ///     @ref comms::protocol::ProtocolLayerBase::endFrameWrite() "default implementation".
+    ///     Discards the data produced by the @ref length() calculation
+    ///     when the outermost write operation is complete.
+    void endFrameWrite(comms::ErrorStatus es) const
+    {
+        BaseImpl::endFrameWrite(es);
+        COMMS_ASSERT(0U < writeDepth_);
+        --writeDepth_;
+        if (writeDepth_ == 0U) {
+            measuredMsg_ = nullptr;
+        }
+    }
+
+    /// @brief Customized update functionality, invoked by @ref update().
+    /// @details The data written by the next layers is finalised before
+    ///     compression, as the result the update request is not forwarded
+    ///     to the next layer.
+    /// @tparam TIter Type of iterator used for updating.
+    /// @tparam TNextLayerWriter next layer updater object type.
+    /// @param[out] field Field object to update.
+    /// @param[in, out] iter Any random access iterator.
+    /// @param[in] size Number of bytes that have been written using write().
+    /// @param[in] nextLayerUpdater Next layer updater object.
+    /// @return Status of the update operation.
+    template <typename TIter, typename TNextLayerUpdater>
+    comms::ErrorStatus doUpdate(
+        Field& field,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerUpdater&& nextLayerUpdater) const
+    {
+        static_cast<void>(nextLayerUpdater);
+        auto es = field.read(iter, size);
+        if (es != ErrorStatus::Success) {
+            return es;
+        }
+
+        std::advance(iter, size - field.length());
+        return ErrorStatus::Success;
+    }
+
+protected:
+    /// @brief Retrieve compression flag from the field.
+    /// @details May be overridden by the extending class
+    /// @param[in] field Field for this layer.
+    static bool isCompressedFromField(const Field& field)
+    {
+        static_assert(comms::field::isIntValue<Field>(),
+            "Field must be of IntValue type");
+
+        return field.value() != static_cast<typename Field::ValueType>(0);
+    }
+
+    /// @brief Prepare field for writing
+    /// @details Must assign provided compression flag.
+    ///     May be overridden by the extending class if some complex functionality is required.
+    /// @param[in] compressed Compression flag.
+    /// @param[out] field Field, value of which needs to be populated
+    static void prepareFieldForWrite(bool compressed, Field& field)
+    {
+        static_assert(
+            comms::field::isIntValue<Field>(),
+            "Field must be of IntValue or EnumValue types");
+
+        field.value() = static_cast<typename Field::ValueType>(compressed ? 1 : 0);
+    }
+
+private:
+    using CompressedData = std::vector<std::uint8_t>;
+
+    template <typename TMsg>
+    using WriteIterator = details::NextLayerBufferWriteIterator<TMsg>;
+
+    template <typename TMsg>
+    using WriteStorage = details::NextLayerBufferStorage<WriteIterator<TMsg> >;
+
+    std::size_t flagFieldLength(bool compressed) const
+    {
+        Field fieldTmp;
+        static_cast<const ExtendingClass*>(this)->prepareFieldForWrite(compressed, fieldTmp);
+        return fieldTmp.length();
+    }
+
+    const CompressedData& measuredData() const
+    {
+        if (measuredCompressed_) {
+            return cachedOutput_;
+        }
+
+        return measuredUncompressed_;
+    }
+
+    template <typename TMsg, typename TStorage>
+    void rememberMeasured(const TMsg& msg, const TStorage& data, bool useCompressed) const
+    {
+        measuredMsg_ = &msg;
+        measuredCompressed_ = useCompressed;
+        measuredUncompressed_.clear();
+        if (!useCompressed) {
+            auto* bytes = reinterpret_cast<const std::uint8_t*>(data.data());
+            measuredUncompressed_.assign(bytes, bytes + data.size());
+        }
+    }
+
+    template <typename TMsg, typename TStorage>
+    comms::ErrorStatus encode(
+        const TMsg& msg,
+        TStorage& data,
+        bool& useCompressed) const
+    {
+        useCompressed = false;
+        auto es =
+            details::NextLayerBufferWriter<WriteIterator<TMsg> >::write(
+                BaseImpl::nextLayer(),
+                msg,
+                data);
+
+        if (es != ErrorStatus::Success) {
+            return es;
+        }
+
+        if (data.size() < ParsedOptionsInternal::MinLength) {
+            return ErrorStatus::Success;
+        }
+
+        static_assert(sizeof(typename TStorage::value_type) == sizeof(std::uint8_t),
+            "The write storage is expected to contain single byte elements");
+
+        auto* bytes = reinterpret_cast<const std::uint8_t*>(data.data());
+        if ((cachedInput_.size() == data.size()) &&
+            std::equal(cachedInput_.begin(), cachedInput_.end(), bytes)) {
+            useCompressed = (cachedOutput_.size() < data.size());
+            return ErrorStatus::Success;
+        }
+
+        cachedInput_.clear();
+        cachedOutput_.clear();
+        es = TCodec().compress(bytes, data.size(), cachedOutput_);
+        if (es != ErrorStatus::Success) {
+            return es;
+        }
+
+        cachedInput_.assign(bytes, bytes + data.size());
+        useCompressed = (cachedOutput_.size() < data.size());
+        return ErrorStatus::Success;
+    }
+
+    template <typename TData, typename TIter>
+    static comms::ErrorStatus writeData(const TData& data, TIter& iter, std::size_t size)
+    {
+        if (size < data.size()) {
+            return ErrorStatus::BufferOverflow;
+        }
+
+        iter = std::copy(data.begin(), data.end(), iter);
+        return ErrorStatus::Success;
+    }
+
+    template <typename TMsg, typename TIter, typename TNextLayerReader, typename... TExtraValues>
+    comms::ErrorStatus readCompressed(
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerReader&& nextLayerReader,
+        TExtraValues... extraValues)
+    {
+        using IterType = typename std::decay<decltype(iter)>::type;
+        static_assert(std::is_pointer<IterType>::value,
+            "Current implementation of CompressionLayer requires iterator used for reading to be a pointer");
+        static_assert(sizeof(*iter) == sizeof(std::uint8_t),
+            "Current implementation of CompressionLayer requires iterator used for reading to point to bytes");
+
+        decompressed_.clear();
+        auto es =
+            TCodec().decompress(
+                reinterpret_cast<const std::uint8_t*>(iter),
+                size,
+                decompressed_,
+                ParsedOptionsInternal::MaxLength);
+
+        if (es != ErrorStatus::Success) {
+            return ErrorStatus::ProtocolError;
+        }
+
+        auto dataIter = reinterpret_cast<IterType>(decompressed_.data());
+        es = nextLayerReader.read(msg, dataIter, decompressed_.size(), extraValues...);
+        if (es == ErrorStatus::NotEnoughData) {
+            // The decompressed data is complete
+            BaseImpl::resetMsg(msg);
+            return ErrorStatus::ProtocolError;
+        }
+
+        std::advance(iter, size);
+        return es;
+    }
+
+    CompressedData decompressed_;
+    mutable CompressedData cachedInput_;
+    mutable CompressedData cachedOutput_;
+    mutable CompressedData measuredUncompressed_;
+    mutable const void* measuredMsg_ = nullptr;
+    mutable std::size_t writeDepth_ = 0U;
+    mutable bool measuredCompressed_ = false;
+};
+
+namespace details
+{
+template <typename T>
+struct CompressionLayerCheckHelper
+{
+    static const bool Value = false;
+};
+
+template <typename TField, typename TCodec, typename TNextLayer, typename... TOptions>
+struct CompressionLayerCheckHelper<CompressionLayer<TField, TCodec, TNextLayer, TOptions...> >
+{
+    static const bool Value = true;
+};
+
+} // namespace details
+
+/// @brief Compile time check of whether the provided type is
+///     a variant of @ref CompressionLayer
+/// @related CompressionLayer
+template <typename T>
+constexpr bool isCompressionLayer()
+{
+    return details::CompressionLayerCheckHelper<T>::Value;
+}
+
+}  // namespace protocol
+
+}  // namespace comms
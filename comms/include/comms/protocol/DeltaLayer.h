@@ -0,0 +1,783 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+
+#include "comms/ErrorStatus.h"
+#include "comms/Assert.h"
+#include "comms/dispatch.h"
+#include "comms/field/IntValue.h"
+#include "comms/util/access.h"
+#include "comms/util/Tuple.h"
+#include "comms/details/message_check.h"
+#include "comms/protocol/ProtocolLayerBase.h"
+#include "comms/protocol/details/DeltaLayerOptionsParser.h"
+#include "comms/protocol/details/DeltaLayerHelpers.h"
+#include "comms/protocol/details/ProtocolLayerExtendingClassHelper.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+/// @brief Protocol layer that transmits only the fields that have changed
+///     since the previous transmission of the same message type.
+/// @details The layer is expected to be placed between
+///     @ref comms::protocol::MsgIdLayer and @ref comms::protocol::MsgDataLayer.
+///     It remembers the field values of the last written and the last read
+///     message of every type listed in @b TAllMessages. The messages of other
+///     types are always written as keyframes. When writing a message, which was
+///     written before, the layer writes the flag field with non-zero value,
+///     followed by the bitmap of changed fields (one bit per field, least
+///     significant bit of the first byte corresponds to the first field) and
+///     the changed fields themselves. Otherwise (keyframe) the flag field is
+///     written with zero value followed by the full message payload written by
+///     the next layer. The keyframe is also written periodically when
+///     @ref comms::option::app::DeltaLayerKeyframeInterval option is used.@n
+///     When reading delta, the layer takes the previously read message of the
+///     same type, updates the received fields and assigns the result to the
+///     message object created by the @ref comms::protocol::MsgIdLayer.
+///     The delta received without previous keyframe of the same message type
+///     is rejected with comms::ErrorStatus::InvalidMsgData.@n
+///     The fields are compared and (de)serialised using their own
+///     comparison operators and @b read() / @b write() member functions,
+///     i.e. the message definitions don't need to be modified. However, the
+///     custom read / write functionality of the message class (if such exists)
+///     is not invoked for the delta frames.
+/// @tparam TField Type of the flag field. Its zero value indicates keyframe.
+/// @tparam TAllMessages All the supported message types, sorted by their IDs.
+///     Every message type must have unique ID.
+/// @tparam TNextLayer Next transport layer in protocol stack, usually
+///     @ref comms::protocol::MsgDataLayer.
+/// @tparam TOptions Default functionality extension options. Supported options are:
+///     @li  @ref comms::option::def::ExtendingClass - Use this option to provide a class
+///         name of the extending class, which can be used to extend existing functionality.
+///     @li @ref comms::option::app::DeltaLayerKeyframeInterval - Periodic keyframe.
+/// @note The message interface class must provide polymorphic ID retrieval (see
+///     @ref comms::option::app::IdInfoInterface).
+/// @note The layer is stateful, the @b write operation updates the state of
+///     the layer even though it is a @b const member function. The state
+///     updates are applied only when the whole frame is successfully
+///     written / read by all the wrapping layers (for example the frame
+///     rejected by the outer @ref comms::protocol::ChecksumLayer doesn't
+///     influence the state). Use @ref resetState() to start from keyframes
+///     (e.g. on reconnection).
+/// @headerfile comms/protocol/DeltaLayer.h
+template <typename TField, typename TAllMessages, typename TNextLayer, typename... TOptions>
+class DeltaLayer : public
+        ProtocolLayerBase<
+            TField,
+            TNextLayer,
+            details::ProtocolLayerExtendingClassT<
+                DeltaLayer<TField, TAllMessages, TNextLayer, TOptions...>,
+                details::DeltaLayerOptionsParser<TOptions...>
+            >,
+            comms::option::ProtocolLayerDisallowReadUntilDataSplit
+        >
+{
+    using ExtendingClass =
+            details::ProtocolLayerExtendingClassT<
+                DeltaLayer<TField, TAllMessages, TNextLayer, TOptions...>,
+                details::DeltaLayerOptionsParser<TOptions...>
+            >;
+
+    using BaseImpl =
+        ProtocolLayerBase<
+            TField,
+            TNextLayer,
+            ExtendingClass,
+            comms::option::ProtocolLayerDisallowReadUntilDataSplit
+        >;
+
+    using ParsedOptionsInternal = details::DeltaLayerOptionsParser<TOptions...>;
+
+    static_assert(comms::details::allMessagesAreStrongSorted<TAllMessages>(),
+        "All the messages are expected to have unique static numeric IDs and be sorted by them");
+
+public:
+    /// @brief Parsed options
+    using ParsedOptions = ParsedOptionsInternal;
+
+    /// @brief Type of the field object used to read/write delta flag.
+    using Field = typename BaseImpl::Field;
+
+    /// @brief All supported messages.
+    using AllMessages = TAllMessages;
+
+    /// @brief Default constructor
+    explicit DeltaLayer() = default;
+
+    /// @brief Copy constructor
+    DeltaLayer(const DeltaLayer&) = default;
+
+    /// @brief Move constructor
+    DeltaLayer(DeltaLayer&&) = default;
+
+    /// @brief Destructor.
+    ~DeltaLayer() noexcept = default;
+
+    /// @brief Copy assignment.
+    DeltaLayer& operator=(const DeltaLayer&) = default;
+
+    /// @brief Move assignment.
+    DeltaLayer& operator=(DeltaLayer&&) = default;
+
+    /// @brief Forget all the previously written and read messages.
+    /// @details The following write of every message type results in keyframe,
+    ///     while the delta of any message type is rejected until the
+    ///     keyframe of the same type is read.
+    void resetState()
+    {
+        txStates_.reset();
+        rxStates_.reset();
+    }
+
+    /// @brief Compile time check whether every frame can be decoded on its own.
+    /// @details The delta frames depend on the previously read keyframes.
+    ///     Hides and overrides the
+    ///     @ref comms::protocol::ProtocolLayerBase::isFrameSelfContained() "default implementation".
+    /// @return false.
+    static constexpr bool isFrameSelfContained()
+    {
+        return false;
+    }
+
+    /// @brief Notify the layer about the beginning of the read operation.
+    /// @details Hides and overrides the
+    ///     @ref comms::protocol::ProtocolLayerBase::beginFrameRead() "default implementation".
+    void beginFrameRead()
+    {
+        rxStates_.begin();
+        BaseImpl::beginFrameRead();
+    }
+
+    /// @brief Notify the layer about the end of the read operation.
+    /// @details Commits the state updated during the read of the frame
+    ///     when the outermost read operation is successful, rolls it back
+    ///     otherwise.
+    void endFrameRead(comms::ErrorStatus es)
+    {
+        BaseImpl::endFrameRead(es);
+        rxStates_.end(es == comms::ErrorStatus::Success);
+    }
+
+    /// @brief Notify the layer about the beginning of the write operation.
+    /// @details Hides and overrides the
+    ///     @ref comms::protocol::ProtocolLayerBase::beginFrameWrite() "default implementation".
+    void beginFrameWrite() const
+    {
+        txStates_.begin();
+        BaseImpl::beginFrameWrite();
+    }
+
+    /// @brief Notify the layer about the end of the write operation.
+    /// @details Commits the state updated during the write of the frame
+    ///     when the outermost write operation is successful, rolls it back
+    ///     otherwise.
+    void endFrameWrite(comms::ErrorStatus es) const
+    {
+        BaseImpl::endFrameWrite(es);
+        txStates_.end((es == comms::ErrorStatus::Success) || (es == comms::ErrorStatus::UpdateRequired));
+    }
+
+    /// @brief Get remaining length of wrapping transport information + length
+    ///     of the provided message.
+    /// @details Reports the length the following write of the message
+    ///     is going to produce, i.e. length of the delta if applicable.
+    /// @param[in] msg Message object.
+    template <typename TMsg>
+    std::size_t length(const TMsg& msg) const
+    {
+        std::size_t len = 0U;
+        if (!invokeTyped(msg, LengthOp<TMsg>(*this, msg, len))) {
+            return flagFieldLength(false) + BaseImpl::nextLayer().length(msg);
+        }
+
+        return len;
+    }
+
+    /// @cond SKIP_DOC
+    using BaseImpl::length;
+    /// @endcond
+
+    /// @brief Customized read functionality, invoked by @ref read().
+    /// @details Reads the flag field. For keyframe forwards the read operation
+    ///     to the next layer and remembers the read message. For delta
+    ///     updates the previously read message with the received fields.
+    /// @tparam TMsg Type of @b msg parameter.
+    /// @tparam TIter Type of iterator used for reading.
+    /// @tparam TNextLayerReader next layer reader object type.
+    /// @param[out] field Field object to read.
+    /// @param[in, out] msg Reference to smart pointer, that already holds
+    ///     allocated message object, or reference to actual message
+    ///     object (which extends @ref comms::MessageBase).
+    /// @param[in, out] iter Input iterator used for reading.
+    /// @param[in] size Size of the data in the sequence
+    /// @param[in] nextLayerReader Reader object, needs to be invoked to
+    ///     forward read operation to the next layer.
+    /// @param[out] extraValues Variadic extra output parameters passed to the
+    ///     "read" operatation of the protocol stack (see
+    ///     @ref comms::protocol::ProtocolLayerBase::read() "read()" and
+    ///     @ref comms::protocol::ProtocolLayerBase::readFieldsCached() "readFieldsCached()").
+    ///     Need to passed on as variadic arguments to the @b nextLayerReader.
+    /// @return Status of the read operation.
+    /// @pre Iterator must be valid and can be dereferenced and incremented at
+    ///      least "size" times;
+    /// @post The iterator will be advanced by the number of bytes was actually
+    ///       read. In case of an error, distance between original position and
+    ///       advanced will pinpoint the location of the error.
+    template <typename TMsg, typename TIter, typename TNextLayerReader, typename... TExtraValues>
+    comms::ErrorStatus doRead(
+        Field& field,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerReader&& nextLayerReader,
+        TExtraValues... extraValues)
+    {
+        auto es = field.read(iter, size);
+        if (es == ErrorStatus::NotEnoughData) {
+            BaseImpl::updateMissingSize(field, size, extraValues...);
+        }
+
+        if (es != ErrorStatus::Success) {
+            return es;
+        }
+
+        auto remSize = size - field.length();
+        auto& msgRef = toMsgRef(msg);
+        using MsgRefType = typename std::remove_reference<decltype(msgRef)>::type;
+        if (!static_cast<ExtendingClass*>(this)->isDeltaFromField(field)) {
+            es = nextLayerReader.read(msg, iter, remSize, extraValues...);
+            if (es == ErrorStatus::Success) {
+                invokeTyped(msgRef, StoreOp<MsgRefType>(*this, msgRef));
+            }
+            return es;
+        }
+
+        es = ErrorStatus::InvalidMsgId;
+        invokeTyped(msgRef, ReadDeltaOp<MsgRefType, TIter>(*this, msgRef, iter, remSize, es));
+        if (es == ErrorStatus::NotEnoughData) {
+            BaseImpl::setMissingSize(1U, extraValues...);
+        }
+        return es;
+    }
+
+    /// @brief Customized write functionality, invoked by @ref write().
+    /// @details Writes the flag field followed either by the full message
+    ///     (keyframe) written by the next layer or by the bitmap of changed
+    ///     fields and the fields themselves. Remembers the written message.
+    /// @tparam TMsg Type of message object.
+    /// @tparam TIter Type of iterator used for writing.
+    /// @tparam TNextLayerWriter next layer writer object type.
+    /// @param[out] field Field object to update and write.
+    /// @param[in] msg Reference to message object
+    /// @param[in, out] iter Output iterator.
+    /// @param[in] size Max number of bytes that can be written.
+    /// @param[in] nextLayerWriter Next layer writer object.
+    /// @return Status of the write operation.
+    /// @pre Iterator must be valid and can be dereferenced and incremented at
+    ///      least "size" times;
+    /// @post The iterator will be advanced by the number of bytes was actually
+    ///       written. In case of an error, distance between original position
+    ///       and advanced will pinpoint the location of the error.
+    template <typename TMsg, typename TIter, typename TNextLayerWriter>
+    comms::ErrorStatus doWrite(
+        Field& field,
+        const TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerWriter&& nextLayerWriter) const
+    {
+        auto es = ErrorStatus::InvalidMsgId;
+        using Writer = typename std::remove_reference<TNextLayerWriter>::type;
+        if (!invokeTyped(msg, WriteOp<TMsg, TIter, Writer>(*this, field, msg, iter, size, nextLayerWriter, es))) {
+            return writeKeyframe(field, msg, iter, size, nextLayerWriter);
+        }
+        return es;
+    }
+
+protected:
+    /// @brief Retrieve delta flag from the field.
+    /// @details May be overridden by the extending class
+    /// @param[in] field Field for this layer.
+    static bool isDeltaFromField(const Field& field)
+    {
+        static_assert(comms::field::isIntValue<Field>(),
+            "Field must be of IntValue type");
+
+        return field.value() != static_cast<typename Field::ValueType>(0);
+    }
+
+    /// @brief Prepare field for writing
+    /// @details Must assign provided delta flag.
+    ///     May be overridden by the extending class if some complex functionality is required.
+    /// @param[in] delta Delta flag.
+    /// @param[out] field Field, value of which needs to be populated
+    static void prepareFieldForWrite(bool delta, Field& field)
+    {
+        static_assert(
+            comms::field::isIntValue<Field>(),
+            "Field must be of IntValue or EnumValue types");
+
+        field.value() = static_cast<typename Field::ValueType>(delta ? 1 : 0);
+    }
+
+private:
+    using States = details::DeltaLayerStatesTxn<details::DeltaLayerStates<TAllMessages> >;
+    using Endian = typename Field::Endian;
+
+    struct InterfaceTag {};
+    struct PtrTag {};
+
+    template <typename TMsg>
+    using MsgPtrTag =
+        typename std::conditional<
+            comms::isMessage<TMsg>(),
+            InterfaceTag,
+            PtrTag
+        >::type;
+
+    template <typename TMsg>
+    static TMsg& toMsgRef(TMsg& msg, InterfaceTag)
+    {
+        return msg;
+    }
+
+    template <typename TMsg>
+    static auto toMsgRef(TMsg& msg, PtrTag) -> decltype(*msg)
+    {
+        COMMS_ASSERT(msg);
+        return *msg;
+    }
+
+    template <typename TMsg>
+    static auto toMsgRef(TMsg& msg) -> decltype(toMsgRef(msg, MsgPtrTag<TMsg>()))
+    {
+        return toMsgRef(msg, MsgPtrTag<TMsg>());
+    }
+
+    struct StaticIdTag {};
+    struct PolymorphicIdTag {};
+
+    template <typename TMsg>
+    static auto getMsgId(const TMsg& msg, StaticIdTag) -> decltype(msg.doGetId())
+    {
+        return msg.doGetId();
+    }
+
+    template <typename TMsg>
+    static auto getMsgId(const TMsg& msg, PolymorphicIdTag) -> decltype(msg.getId())
+    {
+        static_assert(TMsg::hasGetId(),
+            "The message interface class must provide polymorphic ID retrieval");
+        return msg.getId();
+    }
+
+    template <typename TMsg, typename TOp>
+    static bool invokeTyped(const TMsg& msg, TOp&& op)
+    {
+        using Tag =
+            typename std::conditional<
+                comms::isMessageBase<TMsg>(),
+                StaticIdTag,
+                PolymorphicIdTag
+            >::type;
+
+        details::DeltaLayerMsgIdxRetriever<TAllMessages> retriever;
+        if (!comms::dispatchMsgType<TAllMessages>(getMsgId(msg, Tag()), retriever)) {
+            return false;
+        }
+
+        comms::util::tupleForSelectedType<TAllMessages>(retriever.getIdx(), std::forward<TOp>(op));
+        return true;
+    }
+
+    template <typename TMsg, typename TBaseMsg>
+    using IsCastable =
+        std::integral_constant<
+            bool,
+            std::is_same<TMsg, TBaseMsg>::value || std::is_base_of<TBaseMsg, TMsg>::value
+        >;
+
+    std::size_t flagFieldLength(bool delta) const
+    {
+        Field fieldTmp;
+        static_cast<const ExtendingClass*>(this)->prepareFieldForWrite(delta, fieldTmp);
+        return fieldTmp.length();
+    }
+
+    template <std::size_t TIdx>
+    bool isKeyframeRequired() const
+    {
+        auto& state = txStates_.template get<TIdx>();
+        return
+            (!state.valid_) ||
+            (ParsedOptionsInternal::HasKeyframeInterval &&
+                (ParsedOptionsInternal::KeyframeInterval <= state.count_));
+    }
+
+    template <typename TMsg>
+    static std::size_t calcDelta(
+        const TMsg& msg,
+        const typename TMsg::AllFields& prevFields,
+        details::DeltaLayerBitmap<TMsg>& bitmap)
+    {
+        std::size_t len = 0U;
+        bitmap.fill(0U);
+        comms::util::tupleForEachWithTemplateParamIdx(
+            msg.fields(),
+            details::DeltaLayerBitmapCalc<typename TMsg::AllFields>(prevFields, bitmap.data(), len));
+        return len;
+    }
+
+    template <typename TMsg, typename TIter, typename TWriter>
+    comms::ErrorStatus writeKeyframe(
+        Field& field,
+        const TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TWriter& nextLayerWriter) const
+    {
+        static_cast<const ExtendingClass*>(this)->prepareFieldForWrite(false, field);
+        auto es = field.write(iter, size);
+        if (es != ErrorStatus::Success) {
+            return es;
+        }
+
+        COMMS_ASSERT(field.length() <= size);
+        return nextLayerWriter.write(msg, iter, size - field.length());
+    }
+
+    template <std::size_t TIdx, typename TMsg>
+    std::size_t lengthTyped(const TMsg& msg) const
+    {
+        if (isKeyframeRequired<TIdx>()) {
+            return flagFieldLength(false) + BaseImpl::nextLayer().length(msg);
+        }
+
+        details::DeltaLayerBitmap<TMsg> bitmap;
+        auto len = calcDelta(msg, txStates_.template get<TIdx>().fields_, bitmap);
+        return flagFieldLength(true) + bitmap.size() + len;
+    }
+
+    template <std::size_t TIdx, typename TMsg, typename TIter, typename TWriter>
+    comms::ErrorStatus writeTyped(
+        Field& field,
+        const TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TWriter& nextLayerWriter) const
+    {
+        if (isKeyframeRequired<TIdx>()) {
+            auto es = writeKeyframe(field, msg, iter, size, nextLayerWriter);
+            if ((es == ErrorStatus::Success) || (es == ErrorStatus::UpdateRequired)) {
+                auto& state = txStates_.template modify<TIdx>();
+                updateState(state, msg, nullptr);
+                state.valid_ = true;
+                state.count_ = 1U;
+            }
+            return es;
+        }
+
+        details::DeltaLayerBitmap<TMsg> bitmap;
+        auto len = calcDelta(msg, txStates_.template get<TIdx>().fields_, bitmap);
+
+        static_cast<const ExtendingClass*>(this)->prepareFieldForWrite(true, field);
+        auto es = field.write(iter, size);
+        if (es != ErrorStatus::Success) {
+            return es;
+        }
+
+        COMMS_ASSERT(field.length() <= size);
+        auto remSize = size - field.length();
+        if (remSize < (bitmap.size() + len)) {
+            return ErrorStatus::BufferOverflow;
+        }
+
+        for (auto byte : bitmap) {
+            comms::util::writeData(byte, iter, Endian());
+        }
+
+        comms::util::tupleForEachWithTemplateParamIdx(
+            msg.fields(),
+            details::DeltaLayerFieldsWriter<TIter>(bitmap.data(), iter, remSize - bitmap.size(), es));
+
+        if (es != ErrorStatus::Success) {
+            return es;
+        }
+
+        auto& state = txStates_.template modify<TIdx>();
+        updateState(state, msg, bitmap.data());
+        ++state.count_;
+        return es;
+    }
+
+    template <std::size_t TIdx, typename TMsg, typename TIter>
+    comms::ErrorStatus readDeltaTyped(TMsg& msg, TIter& iter, std::size_t size)
+    {
+        auto& state = rxStates_.template get<TIdx>();
+        if (!state.valid_) {
+            return ErrorStatus::InvalidMsgData;
+        }
+
+        details::DeltaLayerBitmap<TMsg> bitmap;
+        if (size < bitmap.size()) {
+            return ErrorStatus::NotEnoughData;
+        }
+
+        for (auto& byte : bitmap) {
+            byte = comms::util::readData<std::uint8_t>(iter, Endian());
+        }
+
+        msg.fields() = state.fields_;
+        auto es = ErrorStatus::Success;
+        comms::util::tupleForEachWithTemplateParamIdx(
+            msg.fields(),
+            details::DeltaLayerFieldsReader<TIter>(bitmap.data(), iter, size - bitmap.size(), es));
+
+        if (es != ErrorStatus::Success) {
+            return es;
+        }
+
+        updateState(rxStates_.template modify<TIdx>(), msg, bitmap.data());
+        return es;
+    }
+
+    template <std::size_t TIdx, typename TMsg>
+    void storeTyped(const TMsg& msg)
+    {
+        auto& state = rxStates_.template modify<TIdx>();
+        updateState(state, msg, nullptr);
+        state.valid_ = true;
+    }
+
+    template <typename TState, typename TMsg>
+    static void updateState(TState& state, const TMsg& msg, const std::uint8_t* bitmap)
+    {
+        comms::util::tupleForEachWithTemplateParamIdx(
+            msg.fields(),
+            details::DeltaLayerStateUpdater<TState>(state, bitmap));
+    }
+
+    template <typename TBaseMsg>
+    class LengthOp
+    {
+    public:
+        LengthOp(const DeltaLayer& layer, const TBaseMsg& msg, std::size_t& len)
+          : layer_(layer),
+            msg_(msg),
+            len_(len)
+        {
+        }
+
+        template <std::size_t TIdx, typename TMsg>
+        void operator()()
+        {
+            exec<TIdx, TMsg>(IsCastable<TMsg, TBaseMsg>());
+        }
+
+    private:
+        template <std::size_t TIdx, typename TMsg>
+        void exec(std::true_type)
+        {
+            len_ = layer_.template lengthTyped<TIdx>(static_cast<const TMsg&>(msg_));
+        }
+
+        template <std::size_t TIdx, typename TMsg>
+        void exec(std::false_type)
+        {
+            COMMS_ASSERT(!"Unexpected message type");
+        }
+
+        const DeltaLayer& layer_;
+        const TBaseMsg& msg_;
+        std::size_t& len_;
+    };
+
+    template <typename TBaseMsg, typename TIter, typename TWriter>
+    class WriteOp
+    {
+    public:
+        WriteOp(
+            const DeltaLayer& layer,
+            Field& field,
+            const TBaseMsg& msg,
+            TIter& iter,
+            std::size_t size,
+            TWriter& nextLayerWriter,
+            comms::ErrorStatus& es)
+          : layer_(layer),
+            field_(field),
+            msg_(msg),
+            iter_(iter),
+            size_(size),
+            nextLayerWriter_(nextLayerWriter),
+            es_(es)
+        {
+        }
+
+        template <std::size_t TIdx, typename TMsg>
+        void operator()()
+        {
+            exec<TIdx, TMsg>(IsCastable<TMsg, TBaseMsg>());
+        }
+
+    private:
+        template <std::size_t TIdx, typename TMsg>
+        void exec(std::true_type)
+        {
+            es_ =
+                layer_.template writeTyped<TIdx>(
+                    field_,
+                    static_cast<const TMsg&>(msg_),
+                    iter_,
+                    size_,
+                    nextLayerWriter_);
+        }
+
+        template <std::size_t TIdx, typename TMsg>
+        void exec(std::false_type)
+        {
+            COMMS_ASSERT(!"Unexpected message type");
+        }
+
+        const DeltaLayer& layer_;
+        Field& field_;
+        const TBaseMsg& msg_;
+        TIter& iter_;
+        std::size_t size_;
+        TWriter& nextLayerWriter_;
+        comms::ErrorStatus& es_;
+    };
+
+    template <typename TBaseMsg, typename TIter>
+    class ReadDeltaOp
+    {
+    public:
+        ReadDeltaOp(
+            DeltaLayer& layer,
+            TBaseMsg& msg,
+            TIter& iter,
+            std::size_t size,
+            comms::ErrorStatus& es)
+          : layer_(layer),
+            msg_(msg),
+            iter_(iter),
+            size_(size),
+            es_(es)
+        {
+        }
+
+        template <std::size_t TIdx, typename TMsg>
+        void operator()()
+        {
+            exec<TIdx, TMsg>(IsCastable<TMsg, TBaseMsg>());
+        }
+
+    private:
+        template <std::size_t TIdx, typename TMsg>
+        void exec(std::true_type)
+        {
+            es_ = layer_.template readDeltaTyped<TIdx>(static_cast<TMsg&>(msg_), iter_, size_);
+        }
+
+        template <std::size_t TIdx, typename TMsg>
+        void exec(std::false_type)
+        {
+            COMMS_ASSERT(!"Unexpected message type");
+        }
+
+        DeltaLayer& layer_;
+        TBaseMsg& msg_;
+        TIter& iter_;
+        std::size_t size_;
+        comms::ErrorStatus& es_;
+    };
+
+    template <typename TBaseMsg>
+    class StoreOp
+    {
+    public:
+        StoreOp(DeltaLayer& layer, const TBaseMsg& msg)
+          : layer_(layer),
+            msg_(msg)
+        {
+        }
+
+        template <std::size_t TIdx, typename TMsg>
+        void operator()()
+        {
+            exec<TIdx, TMsg>(IsCastable<TMsg, TBaseMsg>());
+        }
+
+    private:
+        template <std::size_t TIdx, typename TMsg>
+        void exec(std::true_type)
+        {
+            layer_.template storeTyped<TIdx>(static_cast<const TMsg&>(msg_));
+        }
+
+        template <std::size_t TIdx, typename TMsg>
+        void exec(std::false_type)
+        {
+            COMMS_ASSERT(!"Unexpected message type");
+        }
+
+        DeltaLayer& layer_;
+        const TBaseMsg& msg_;
+    };
+
+    mutable States txStates_;
+    States rxStates_;
+};
+
+namespace details
+{
+template <typename T>
+struct DeltaLayerCheckHelper
+{
+    static const bool Value = false;
+};
+
+template <typename TField, typename TAllMessages, typename TNextLayer, typename... TOptions>
+struct DeltaLayerCheckHelper<DeltaLayer<TField, TAllMessages, TNextLayer, TOptions...> >
+{
+    static const bool Value = true;
+};
+
+} // namespace details
+
+/// @brief Compile time check of whether the provided type is
+///     a variant of @ref DeltaLayer
+/// @related DeltaLayer
+template <typename T>
+constexpr bool isDeltaLayer()
+{
+    return details::DeltaLayerCheckHelper<T>::Value;
+}
+
+}  // namespace protocol
+
+}  // namespace comms
@@ -0,0 +1,157 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of @ref comms::protocol::FlatProtocolStack
+
+#pragma once
+
+#include <cstddef>
+
+#include "comms/ErrorStatus.h"
+#include "comms/protocol/details/FlatProtocolStackHelper.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+/// @brief Protocol stack wrapper, which fuses the outer framing layers
+///     into a single read function.
+/// @details The default read of the protocol stack is performed as a chain
+///     of calls to @b doRead() member functions of every layer. This wrapper
+///     collapses the outermost sequence of @ref SyncPrefixLayer layers, optionally
+///     followed by the @ref MsgSizeLayer and the @ref MsgIdLayer, into a
+///     single function. The fields of such sequence are read with a single
+///     check of the input buffer size per group of fixed length fields
+///     (the fields up to and including the size one, and the message ID
+///     field bounded by the reported size), after which the message
+///     is created and the read is dispatched directly to the layer
+///     following the @ref MsgIdLayer. The layers that cannot be fused
+///     are read in a default (layered) way.
+///     The fused layers must use fixed length fields and no extending class
+///     (see @ref comms::option::def::ExtendingClass). When the input buffer
+///     is too short to contain all the fields of the group, the default
+///     (layered) read is used. The returned status, missing size information,
+///     and iterator position are the same as ones of the default read.
+///     All the other operations are inherited from the wrapped stack as-is.
+///     @code
+///     using MyFlatStack = comms::protocol::FlatProtocolStack<MyProtocolStack>;
+///     MyFlatStack stack;
+///     auto es = stack.read(msgPtr, readIter, bufSize);
+///     @endcode
+/// @tparam TStack Protocol stack (outermost layer) type.
+/// @headerfile comms/protocol/FlatProtocolStack.h
+template <typename TStack>
+class FlatProtocolStack : public TStack
+{
+    using BaseImpl = TStack;
+    using OuterLayer = details::FlatProtocolStackActualLayerT<TStack>;
+
+public:
+    /// @brief Default constructor
+    FlatProtocolStack() = default;
+
+    /// @brief Copy constructor
+    FlatProtocolStack(const FlatProtocolStack&) = default;
+
+    /// @brief Move constructor
+    FlatProtocolStack(FlatProtocolStack&&) = default;
+
+    /// @brief Destructor
+    ~FlatProtocolStack() noexcept = default;
+
+    /// @brief Copy assignment
+    FlatProtocolStack& operator=(const FlatProtocolStack&) = default;
+
+    /// @brief Move assignment
+    FlatProtocolStack& operator=(FlatProtocolStack&&) = default;
+
+    /// @brief Total serialisation length of all the fused fields.
+    /// @details Equals to 0 when none of the outer layers can be fused.
+    static constexpr std::size_t fusedLength()
+    {
+        return details::FlatProtocolStackGroupLength<OuterLayer>::Value;
+    }
+
+    /// @brief Compile time inquiry whether any of the outer layers are fused.
+    static constexpr bool isFlattened()
+    {
+        return 0U < fusedLength();
+    }
+
+    /// @brief Deserialise message from the input data sequence.
+    /// @details Has the same interface and semantics as
+    ///     @ref comms::protocol::ProtocolLayerBase::read() "read()" of the
+    ///     wrapped stack.
+    template <typename TMsg, typename TIter, typename... TExtraValues>
+    comms::ErrorStatus read(
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TExtraValues... extraValues)
+    {
+        if (size < fusedLength()) {
+            return BaseImpl::read(msg, iter, size, extraValues...);
+        }
+
+        BaseImpl::beginFrameRead();
+        auto es =
+            details::FlatProtocolStackHelper::readFused(
+                details::flatProtocolStackActualLayer(static_cast<BaseImpl&>(*this)),
+                msg,
+                iter,
+                size,
+                extraValues...);
+
+        if (es != comms::ErrorStatus::Success) {
+            BaseImpl::discardPendingMsgs();
+        }
+        BaseImpl::endFrameRead(es);
+        return es;
+    }
+};
+
+namespace details
+{
+template <typename T>
+struct FlatProtocolStackCheckHelper
+{
+    static const bool Value = false;
+};
+
+template <typename TStack>
+struct FlatProtocolStackCheckHelper<FlatProtocolStack<TStack> >
+{
+    static const bool Value = true;
+};
+
+} // namespace details
+
+/// @brief Compile time check of whether the provided type is
+///     a variant of @ref FlatProtocolStack
+/// @related FlatProtocolStack
+template <typename T>
+constexpr bool isFlatProtocolStack()
+{
+    return details::FlatProtocolStackCheckHelper<T>::Value;
+}
+
+} // namespace protocol
+
+} // namespace comms
@@ -0,0 +1,676 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <chrono>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+#include <algorithm>
+
+#include "comms/ErrorStatus.h"
+#include "comms/Assert.h"
+#include "comms/field/IntValue.h"
+#include "comms/details/process.h"
+#include "comms/details/MessageInterfaceOptionsParser.h"
+#include "comms/protocol/ProtocolLayerBase.h"
+#include "comms/protocol/MsgSizeLayer.h"
+#include "comms/protocol/details/MsgBatchLayerOptionsParser.h"
+#include "comms/protocol/details/MsgBatchLayerMsgQueue.h"
+#include "comms/protocol/details/NextLayerBufferWriter.h"
+#include "comms/protocol/details/ProtocolLayerExtendingClassHelper.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+/// @brief Protocol layer that packs multiple messages into a single
+///     transport frame.
+/// @details The layer prefixes the sequence of serialised messages with the
+///     number of messages in the batch. Every message entry is
+///     (de)serialised by the next layer(s), which usually are
+///     @ref comms::protocol::MsgIdLayer, @ref comms::protocol::MsgSizeLayer and
+///     @ref comms::protocol::MsgDataLayer. The layer itself is expected to be
+///     wrapped by other transport layers (such as @ref comms::protocol::SyncPrefixLayer,
+///     @ref comms::protocol::MsgSizeLayer and @ref comms::protocol::ChecksumLayer),
+///     which are applied once per whole batch.@n
+///     During the read operation all the messages of the batch are created,
+///     the first one is returned to the caller, while others are kept
+///     inside the layer and can be retrieved using
+///     @ref comms::protocol::ProtocolLayerBase::takePendingMsg() "takePendingMsg()".
+///     The @ref page_dispatch "processing helper functions" (defined in comms/process.h)
+///     do it automatically.@n
+///     During the write operation the messages are serialised into the
+///     @ref Batch object using @ref addMsg(), and the batch itself is passed
+///     to the @b write() member function of the protocol stack instead of
+///     the message object. Passing a single message object to the @b write()
+///     member function writes a batch of a single message.
+/// @tparam TField Type of the field used to (de)serialise number of messages
+///     in the batch.
+/// @tparam TNextLayer Next transport layer in protocol stack, used to
+///     (de)serialise every message entry.
+/// @tparam TOptions Default functionality extension options. Supported options are:
+///     @li  @ref comms::option::def::ExtendingClass - Use this option to provide a class
+///         name of the extending class, which can be used to extend existing functionality.
+///     @li @ref comms::option::app::MsgBatchLayerFlushCount - Limit number
+///         of messages in a single batch.
+///     @li @ref comms::option::app::MsgBatchLayerFlushBytes - Limit
+///         serialisation length of a single batch.
+///     @li @ref comms::option::app::MsgBatchLayerFlushTime - Limit amount of
+///         time the messages are accumulated in a single batch.
+/// @note Only read into smart pointer to message object
+///     (@ref comms::protocol::ProtocolLayerBase::MsgPtr "MsgPtr") is supported.
+/// @headerfile comms/protocol/MsgBatchLayer.h
+template <typename TField, typename TNextLayer, typename... TOptions>
+class MsgBatchLayer : public
+        ProtocolLayerBase<
+            TField,
+            TNextLayer,
+            details::ProtocolLayerExtendingClassT<
+                MsgBatchLayer<TField, TNextLayer, TOptions...>,
+                details::MsgBatchLayerOptionsParser<TOptions...>
+            >,
+            comms::option::ProtocolLayerDisallowReadUntilDataSplit
+        >
+{
+    using ExtendingClass =
+            details::ProtocolLayerExtendingClassT<
+                MsgBatchLayer<TField, TNextLayer, TOptions...>,
+                details::MsgBatchLayerOptionsParser<TOptions...>
+            >;
+
+    using BaseImpl =
+        ProtocolLayerBase<
+            TField,
+            TNextLayer,
+            ExtendingClass,
+            comms::option::ProtocolLayerDisallowReadUntilDataSplit
+        >;
+
+    using ParsedOptionsInternal = details::MsgBatchLayerOptionsParser<TOptions...>;
+
+public:
+    /// @brief Parsed options
+    using ParsedOptions = ParsedOptionsInternal;
+
+    /// @brief Type of the field object used to read/write number of messages.
+    using Field = typename BaseImpl::Field;
+
+    /// @brief Type of smart pointer that holds allocated message object.
+    using MsgPtr = typename BaseImpl::MsgPtr;
+
+    static_assert(!std::is_void<MsgPtr>::value,
+        "MsgBatchLayer is expected to wrap layer that allocates message objects (such as MsgIdLayer)");
+
+    /// @brief Type of message ID.
+    using MsgIdType = comms::details::ProcessMsgIdType<MsgPtr>;
+
+    /// @brief Collection of serialised messages to be written as single frame.
+    /// @details Messages are added using @ref MsgBatchLayer::addMsg(). The
+    ///     batch object is expected to be passed to the @b write() member
+    ///     function of the protocol stack instead of a message object.
+    class Batch
+    {
+    public:
+        /// @brief Type of the storage of serialised messages
+        /// @details Same as container used by the write iterator of the
+        ///     message interface (if it is @b std::back_insert_iterator),
+        ///     @b std::vector<std::uint8_t> otherwise.
+        using Storage =
+            details::NextLayerBufferStorage<
+                details::NextLayerBufferWriteIterator<typename MsgPtr::element_type>
+            >;
+
+        /// @brief Interface options, allow usage of the batch object by
+        ///     the wrapping layers in the same way as message object.
+        using InterfaceOptions =
+            comms::details::MessageInterfaceOptionsParser<comms::option::app::LengthInfoInterface>;
+
+        /// @brief Number of messages in the batch.
+        std::size_t count() const
+        {
+            return count_;
+        }
+
+        /// @brief Check whether the batch is empty.
+        bool empty() const
+        {
+            return count_ == 0U;
+        }
+
+        /// @brief Serialisation length of all the messages in the batch.
+        std::size_t length() const
+        {
+            return data_.size();
+        }
+
+        /// @brief Access serialised messages.
+        const Storage& data() const
+        {
+            return data_;
+        }
+
+        /// @brief Remove all the messages from the batch.
+        void clear()
+        {
+            data_.clear();
+            count_ = 0U;
+        }
+
+        /// @brief Check whether the batch needs to be flushed (written).
+        /// @details Takes into account all the flush policies provided
+        ///     as options to the @ref MsgBatchLayer. Always returns
+        ///     @b false if no such option has been used.
+        bool isFlushRequired() const
+        {
+            if (empty()) {
+                return false;
+            }
+
+            return
+                (ParsedOptionsInternal::HasFlushCount && (ParsedOptionsInternal::FlushCount <= count_)) ||
+                (ParsedOptionsInternal::HasFlushBytes && (ParsedOptionsInternal::FlushBytes <= data_.size())) ||
+                (ParsedOptionsInternal::HasFlushTime && isFlushTimeExpired());
+        }
+
+    private:
+        friend class MsgBatchLayer<TField, TNextLayer, TOptions...>;
+
+        using Clock = std::chrono::steady_clock;
+
+        void onMsgAdded()
+        {
+            if (ParsedOptionsInternal::HasFlushTime && (count_ == 0U)) {
+                firstTimestamp_ = Clock::now();
+            }
+
+            ++count_;
+        }
+
+        bool isFlushTimeExpired() const
+        {
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - firstTimestamp_);
+            return static_cast<unsigned long long>(ParsedOptionsInternal::FlushTime) <= static_cast<unsigned long long>(elapsed.count());
+        }
+
+        Storage data_;
+        std::size_t count_ = 0U;
+        Clock::time_point firstTimestamp_;
+    };
+
+    /// @brief Default constructor
+    explicit MsgBatchLayer() = default;
+
+    /// @brief Copy constructor
+    MsgBatchLayer(const MsgBatchLayer&) = default;
+
+    /// @brief Move constructor
+    MsgBatchLayer(MsgBatchLayer&&) = default;
+
+    /// @brief Destructor.
+    ~MsgBatchLayer() noexcept = default;
+
+    /// @brief Copy assignment.
+    MsgBatchLayer& operator=(const MsgBatchLayer&) = default;
+
+    /// @brief Move assignment.
+    MsgBatchLayer& operator=(MsgBatchLayer&&) = default;
+
+    /// @brief Serialise message and add it to the batch.
+    /// @details Uses next layer(s) to serialise the message entry.
+    /// @param[in, out] batch Batch object.
+    /// @param[in] msg Message object.
+    /// @return Status of the write operation.
+    template <typename TMsg>
+    comms::ErrorStatus addMsg(Batch& batch, const TMsg& msg) const
+    {
+        using WriteIterator = details::NextLayerBufferWriteIterator<TMsg>;
+        auto es =
+            details::NextLayerBufferWriter<WriteIterator>::write(
+                BaseImpl::nextLayer(),
+                msg,
+                batch.data_);
+
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        batch.onMsgAdded();
+        return es;
+    }
+
+    /// @brief Compile time check whether every frame can be decoded on its own.
+    /// @details The messages of the batch are retrieved one by one
+    ///     via @ref takePendingMsg() after the read of the frame.
+    /// @return false.
+    static constexpr bool isFrameSelfContained()
+    {
+        return false;
+    }
+
+    /// @brief Check whether there are messages left from the recently read batch.
+    bool hasPendingMsg() const
+    {
+        return !pendingMsgs_.empty();
+    }
+
+    /// @brief Retrieve the next message left from the recently read batch.
+    /// @param[out] msg Smart pointer to receive the message object.
+    /// @param[out] extraValues Extra output parameters provided using
+    ///     @ref comms::protocol::msgId() and / or @ref comms::protocol::msgIndex().
+    /// @return @b true in case the message object has been retrieved,
+    ///     @b false if there are no pending messages.
+    template <typename TMsg, typename... TExtraValues>
+    bool takePendingMsg(TMsg& msg, TExtraValues... extraValues)
+    {
+        using Tag =
+            typename std::conditional<
+                std::is_same<MsgPtr, typename std::decay<decltype(msg)>::type>::value,
+                MsgPtrTag,
+                MsgObjTag
+            >::type;
+        return takePendingMsgInternal(msg, Tag(), extraValues...);
+    }
+
+    /// @brief Discard the messages left from the recently read batch.
+    /// @details Invoked when any of the wrapping layers rejects the frame
+    ///     (for example on checksum mismatch).
+    void discardPendingMsgs()
+    {
+        pendingMsgs_.clear();
+    }
+
+    /// @brief Get remaining length of wrapping transport information + length
+    ///     of the provided message or batch.
+    /// @param[in] msg Message object or @ref Batch.
+    template <typename TMsg>
+    std::size_t length(const TMsg& msg) const
+    {
+        using Tag =
+            typename std::conditional<
+                std::is_same<Batch, TMsg>::value,
+                BatchTag,
+                SingleMsgTag
+            >::type;
+        return lengthInternal(msg, Tag());
+    }
+
+    /// @cond SKIP_DOC
+    using BaseImpl::length;
+    /// @endcond
+
+    /// @brief Customized read functionality, invoked by @ref read().
+    /// @details Reads number of messages in the batch, then reads all
+    ///     the message entries by forwarding the read operation to
+    ///     the next layer. The first successfully read message is
+    ///     returned, while others are stored to be retrieved using
+    ///     @ref takePendingMsg(). When the next layer is
+    ///     @ref comms::protocol::MsgSizeLayer (the boundaries of the entries
+    ///     are known), the entries that failed to be read due to unknown ID
+    ///     or invalid data are skipped. Otherwise any error terminates the
+    ///     read of the whole batch and no message is created.
+    /// @tparam TMsg Type of @b msg parameter.
+    /// @tparam TIter Type of iterator used for reading.
+    /// @tparam TNextLayerReader next layer reader object type.
+    /// @param[out] field Field object to read.
+    /// @param[in, out] msg Reference to smart pointer, that will hold
+    ///     allocated message object.
+    /// @param[in, out] iter Input iterator used for reading.
+    /// @param[in] size Size of the data in the sequence
+    /// @param[in] nextLayerReader Reader object, needs to be invoked to
+    ///     forward read operation to the next layer.
+    /// @param[out] extraValues Variadic extra output parameters passed to the
+    ///     "read" operatation of the protocol stack (see
+    ///     @ref comms::protocol::ProtocolLayerBase::read() "read()" and
+    ///     @ref comms::protocol::ProtocolLayerBase::readFieldsCached() "readFieldsCached()").
+    ///     Updated with values of the first successfully read message.
+    /// @return Status of the read operation.
+    /// @pre Iterator must be valid and can be dereferenced and incremented at
+    ///      least "size" times;
+    /// @post The iterator will be advanced by the number of bytes was actually
+    ///       read. In case of an error, distance between original position and
+    ///       advanced will pinpoint the location of the error.
+    template <typename TMsg, typename TIter, typename TNextLayerReader, typename... TExtraValues>
+    comms::ErrorStatus doRead(
+        Field& field,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerReader&& nextLayerReader,
+        TExtraValues... extraValues)
+    {
+        static_assert(std::is_same<MsgPtr, typename std::decay<decltype(msg)>::type>::value,
+            "MsgBatchLayer supports read into smart pointer to message object only");
+
+        using IterType = typename std::decay<decltype(iter)>::type;
+        using IterTag = typename std::iterator_traits<IterType>::iterator_category;
+        static_assert(
+            std::is_base_of<std::random_access_iterator_tag, IterTag>::value,
+            "Current implementation of MsgBatchLayer requires iterator used for reading to be random-access one.");
+
+        pendingMsgs_.clear();
+
+        auto begIter = iter;
+        auto es = field.read(iter, size);
+        if (es == ErrorStatus::NotEnoughData) {
+            BaseImpl::updateMissingSize(field, size, extraValues...);
+        }
+
+        if (es != ErrorStatus::Success) {
+            return es;
+        }
+
+        auto count = static_cast<ExtendingClass*>(this)->getMsgCountFromField(field);
+        if (count == 0U) {
+            return ErrorStatus::ProtocolError;
+        }
+
+        auto remSize = size - static_cast<std::size_t>(std::distance(begIter, iter));
+        auto result = ErrorStatus::Success;
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            auto entryIter = iter;
+            MsgPtr entryMsg;
+            MsgIdType entryId = MsgIdType();
+            std::size_t entryIdx = 0U;
+            std::size_t entryMissingSize = 0U;
+
+            if (!msg) {
+                es =
+                    nextLayerReader.read(
+                        entryMsg,
+                        iter,
+                        remSize,
+                        extraValues...,
+                        comms::protocol::msgId(entryId),
+                        comms::protocol::msgIndex(entryIdx),
+                        comms::protocol::missingSize(entryMissingSize));
+            }
+            else {
+                es =
+                    nextLayerReader.read(
+                        entryMsg,
+                        iter,
+                        remSize,
+                        comms::protocol::msgId(entryId),
+                        comms::protocol::msgIndex(entryIdx),
+                        comms::protocol::missingSize(entryMissingSize));
+            }
+
+            auto consumed = static_cast<std::size_t>(std::distance(entryIter, iter));
+            COMMS_ASSERT(consumed <= remSize);
+            remSize -= consumed;
+
+            if (es == ErrorStatus::Success) {
+                COMMS_ASSERT(entryMsg);
+                if (!msg) {
+                    msg = std::move(entryMsg);
+                    continue;
+                }
+
+                pendingMsgs_.push(std::move(entryMsg), entryId, entryIdx);
+                continue;
+            }
+
+            if (es == ErrorStatus::NotEnoughData) {
+                BaseImpl::setMissingSize(entryMissingSize, extraValues...);
+            }
+
+            if ((es == ErrorStatus::NotEnoughData) ||
+                (es == ErrorStatus::ProtocolError) ||
+                (!comms::protocol::isMsgSizeLayer<TNextLayer>())) {
+                // The boundary of the next entry is unknown
+                BaseImpl::resetMsg(msg);
+                pendingMsgs_.clear();
+                return es;
+            }
+
+            result = es;
+        }
+
+        if (!msg) {
+            return result;
+        }
+
+        return ErrorStatus::Success;
+    }
+
+    /// @brief Customized write functionality, invoked by @ref write().
+    /// @details If @ref Batch object is passed as the @b msg parameter, writes
+    ///     number of messages in the batch followed by all the serialised
+    ///     message entries. Otherwise writes batch of a single message
+    ///     by calling the write() member function of the next layer.
+    /// @tparam TMsg Type of message object or @ref Batch.
+    /// @tparam TIter Type of iterator used for writing.
+    /// @tparam TNextLayerWriter next layer writer object type.
+    /// @param[out] field Field object to update and write.
+    /// @param[in] msg Reference to message object or @ref Batch.
+    /// @param[in, out] iter Output iterator.
+    /// @param[in] size Max number of bytes that can be written.
+    /// @param[in] nextLayerWriter Next layer writer object.
+    /// @return Status of the write operation.
+    /// @pre Iterator must be valid and can be dereferenced and incremented at
+    ///      least "size" times;
+    /// @post The iterator will be advanced by the number of bytes was actually
+    ///       written. In case of an error, distance between original position
+    ///       and advanced will pinpoint the location of the error.
+    template <typename TMsg, typename TIter, typename TNextLayerWriter>
+    comms::ErrorStatus doWrite(
+        Field& field,
+        const TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerWriter&& nextLayerWriter) const
+    {
+        using Tag =
+            typename std::conditional<
+                std::is_same<Batch, TMsg>::value,
+                BatchTag,
+                SingleMsgTag
+            >::type;
+        return writeInternal(field, msg, iter, size, std::forward<TNextLayerWriter>(nextLayerWriter), Tag());
+    }
+
+    /// @brief Customized update functionality, invoked by @ref update().
+    /// @details Forwards the update request to the next layer only when
+    ///     batch contains single message. The message entries of a larger batch
+    ///     are finalised when added to the @ref Batch object.
+    /// @tparam TIter Type of iterator used for updating.
+    /// @tparam TNextLayerWriter next layer updater object type.
+    /// @param[out] field Field object to update.
+    /// @param[in, out] iter Any random access iterator.
+    /// @param[in] size Number of bytes that have been written using write().
+    /// @param[in] nextLayerUpdater Next layer updater object.
+    /// @return Status of the update operation.
+    template <typename TIter, typename TNextLayerUpdater>
+    comms::ErrorStatus doUpdate(
+        Field& field,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerUpdater&& nextLayerUpdater) const
+    {
+        auto es = field.read(iter, size);
+        if (es != ErrorStatus::Success) {
+            return es;
+        }
+
+        auto remSize = size - field.length();
+        if (static_cast<const ExtendingClass*>(this)->getMsgCountFromField(field) == 1U) {
+            return nextLayerUpdater.update(iter, remSize);
+        }
+
+        std::advance(iter, remSize);
+        return ErrorStatus::Success;
+    }
+
+protected:
+    /// @brief Retrieve number of messages from the field.
+    /// @details May be overridden by the extending class
+    /// @param[in] field Field for this layer.
+    static std::size_t getMsgCountFromField(const Field& field)
+    {
+        static_assert(comms::field::isIntValue<Field>(),
+            "Field must be of IntValue type");
+
+        return static_cast<std::size_t>(field.value());
+    }
+
+    /// @brief Prepare field for writing
+    /// @details Must assign provided number of messages.
+    ///     May be overridden by the extending class if some complex functionality is required.
+    /// @param[in] count Number of messages in the batch.
+    /// @param[out] field Field, value of which needs to be populated
+    static void prepareFieldForWrite(std::size_t count, Field& field)
+    {
+        static_assert(
+            comms::field::isIntValue<Field>(),
+            "Field must be of IntValue or EnumValue types");
+
+        field.value() = static_cast<typename Field::ValueType>(count);
+    }
+
+private:
+    struct BatchTag {};
+    struct SingleMsgTag {};
+    struct MsgPtrTag {};
+    struct MsgObjTag {};
+
+    using PendingMsgs = details::MsgBatchLayerMsgQueue<MsgPtr, MsgIdType>;
+
+    template <typename TMsg, typename... TExtraValues>
+    bool takePendingMsgInternal(TMsg& msg, MsgPtrTag, TExtraValues... extraValues)
+    {
+        if (pendingMsgs_.empty()) {
+            return false;
+        }
+
+        MsgIdType id = MsgIdType();
+        std::size_t idx = 0U;
+        msg = pendingMsgs_.pop(id, idx);
+        BaseImpl::setMsgId(id, extraValues...);
+        BaseImpl::setMsgIndex(idx, extraValues...);
+        return true;
+    }
+
+    template <typename TMsg, typename... TExtraValues>
+    static bool takePendingMsgInternal(TMsg& msg, MsgObjTag, TExtraValues...)
+    {
+        static_cast<void>(msg);
+        return false;
+    }
+
+    std::size_t countFieldLength(std::size_t count) const
+    {
+        Field fieldTmp;
+        static_cast<const ExtendingClass*>(this)->prepareFieldForWrite(count, fieldTmp);
+        return fieldTmp.length();
+    }
+
+    std::size_t lengthInternal(const Batch& batch, BatchTag) const
+    {
+        return countFieldLength(batch.count()) + batch.length();
+    }
+
+    template <typename TMsg>
+    std::size_t lengthInternal(const TMsg& msg, SingleMsgTag) const
+    {
+        return countFieldLength(1U) + BaseImpl::nextLayer().length(msg);
+    }
+
+    template <typename TIter, typename TWriter>
+    comms::ErrorStatus writeInternal(
+        Field& field,
+        const Batch& batch,
+        TIter& iter,
+        std::size_t size,
+        TWriter&& nextLayerWriter,
+        BatchTag) const
+    {
+        static_cast<void>(nextLayerWriter);
+        if (batch.empty()) {
+            return ErrorStatus::InvalidMsgData;
+        }
+
+        static_cast<const ExtendingClass*>(this)->prepareFieldForWrite(batch.count(), field);
+        auto es = field.write(iter, size);
+        if (es != ErrorStatus::Success) {
+            return es;
+        }
+
+        COMMS_ASSERT(field.length() <= size);
+        if ((size - field.length()) < batch.length()) {
+            return ErrorStatus::BufferOverflow;
+        }
+
+        iter = std::copy(batch.data().begin(), batch.data().end(), iter);
+        return ErrorStatus::Success;
+    }
+
+    template <typename TMsg, typename TIter, typename TWriter>
+    comms::ErrorStatus writeInternal(
+        Field& field,
+        const TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TWriter&& nextLayerWriter,
+        SingleMsgTag) const
+    {
+        static_cast<const ExtendingClass*>(this)->prepareFieldForWrite(1U, field);
+        auto es = field.write(iter, size);
+        if (es != ErrorStatus::Success) {
+            return es;
+        }
+
+        COMMS_ASSERT(field.length() <= size);
+        return nextLayerWriter.write(msg, iter, size - field.length());
+    }
+
+    PendingMsgs pendingMsgs_;
+};
+
+namespace details
+{
+template <typename T>
+struct MsgBatchLayerCheckHelper
+{
+    static const bool Value = false;
+};
+
+template <typename TField, typename TNextLayer, typename... TOptions>
+struct MsgBatchLayerCheckHelper<MsgBatchLayer<TField, TNextLayer, TOptions...> >
+{
+    static const bool Value = true;
+};
+
+} // namespace details
+
+/// @brief Compile time check of whether the provided type is
+///     a variant of @ref MsgBatchLayer
+/// @related MsgBatchLayer
+template <typename T>
+constexpr bool isMsgBatchLayer()
+{
+    return details::MsgBatchLayerCheckHelper<T>::Value;
+}
+
+}  // namespace protocol
+
+}  // namespace comms
@@ -437,6 +437,85 @@ public:
         return comms::ErrorStatus::Success;
     }
 
+    /// @brief Compile time check whether every frame can be decoded on its own.
+    /// @details Part of the interface required by the wrapping layers,
+    ///     see @ref comms::protocol::ProtocolLayerBase::isFrameSelfContained().
+    /// @return true.
+    static constexpr bool isFrameSelfContained()
+    {
+        return true;
+    }
+
+    /// @brief Check whether there are messages left from the recently read
+    ///     batch of messages.
+    /// @details Part of the interface required by the wrapping layers,
+    ///     see @ref comms::protocol::ProtocolLayerBase::hasPendingMsg().
+    /// @return false.
+    static constexpr bool hasPendingMsg()
+    {
+        return false;
+    }
+
+    /// @brief Retrieve the message left from the recently read batch of messages.
+    /// @details Part of the interface required by the wrapping layers,
+    ///     see @ref comms::protocol::ProtocolLayerBase::takePendingMsg().
+    /// @return false.
+    template <typename TMsg, typename... TExtraValues>
+    static bool takePendingMsg(TMsg& msg, TExtraValues...)
+    {
+        static_cast<void>(msg);
+        return false;
+    }
+
+    /// @brief Discard messages left from the recently read batch of messages.
+    /// @details Part of the interface required by the wrapping layers,
+    ///     see @ref comms::protocol::ProtocolLayerBase::discardPendingMsgs().
+    ///     Does nothing.
+    static void discardPendingMsgs()
+    {
+    }
+
+    /// @brief Notify the layers about the beginning of the read operation.
+    /// @details Part of the interface required by the wrapping layers,
+    ///     see @ref comms::protocol::ProtocolLayerBase::beginFrameRead().
+    ///     Does nothing.
+    static void beginFrameRead()
+    {
+    }
+
+    /// @brief Notify the layers about the end of the read operation.
+    /// @details Part of the interface required by the wrapping layers,
+    ///     see @ref comms::protocol::ProtocolLayerBase::endFrameRead().
+    ///     Does nothing.
+    static void endFrameRead(comms::ErrorStatus)
+    {
+    }
+
+    /// @brief Notify the layers about the beginning of the write operation.
+    /// @details Part of the interface required by the wrapping layers,
+    ///     see @ref comms::protocol::ProtocolLayerBase::beginFrameWrite().
+    ///     Does nothing.
+    static void beginFrameWrite()
+    {
+    }
+
+    /// @brief Notify the layers about the end of the write operation.
+    /// @details Part of the interface required by the wrapping layers,
+    ///     see @ref comms::protocol::ProtocolLayerBase::endFrameWrite().
+    ///     Does nothing.
+    static void endFrameWrite(comms::ErrorStatus)
+    {
+    }
+
+    /// @brief Compile time inquiry whether the released message objects are reused.
+    /// @details Part of the interface required by the wrapping layers,
+    ///     see @ref comms::protocol::ProtocolLayerBase::hasMsgRecycling().
+    /// @return false.
+    static constexpr bool hasMsgRecycling()
+    {
+        return false;
+    }
+
     /// @brief Get remaining length of wrapping transport information.
     /// @details The message data always get wrapped with transport information
     ///     to be successfully delivered to and unpacked on the other side.
@@ -33,7 +33,11 @@
 #include "comms/fields.h"
 #include "comms/MsgFactory.h"
 #include "comms/dispatch.h"
+#include "comms/details/InstrumentationHelper.h"
+#include "comms/protocol/MsgDataLayer.h"
 #include "comms/protocol/details/MsgIdLayerOptionsParser.h"
+#include "comms/protocol/details/MsgIdLayerMsgCache.h"
+#include "comms/protocol/details/MsgLengthBoundsTable.h"
 #include "comms/protocol/details/ProtocolLayerExtendingClassHelper.h"
 
 namespace comms
@@ -42,6 +46,11 @@ namespace comms
 namespace protocol
 {
 
+namespace details
+{
+class FlatProtocolStackHelper;
+} // namespace details
+
 /// @brief Protocol layer that uses uses message ID field as a prefix to all the
 ///        subsequent data written by other (next) layers.
 /// @details The main purpose of this layer is to process the message ID information.
@@ -56,6 +65,8 @@ namespace protocol
 ///     @li @ref comms::option::def::ExtendingClass - Use this option to provide a class
 ///         name of the extending class, which can be used to extend existing functionality.
 ///         See also @ref page_custom_id_layer tutorial page.
+///     @li @ref comms::option::app::MsgRecycling - Use this option to enable
+///         reuse of the message objects released using @ref recycleMsg().
 ///     @li All the options supported by the @ref comms::MsgFactory. All the options
 ///         except ones listed above will be forwarded to the definition of the
 ///         inner instance of @ref comms::MsgFactory.
@@ -100,6 +111,16 @@ class MsgIdLayer : public
         "Usage of MsgIdLayer requires support for ID type. "
         "Use comms::option::def::MsgIdType option in message interface type definition.");
 
+    static_assert((!ParsedOptionsInternal::HasMsgRecycling) || (!Factory::ParsedOptions::HasInPlaceAllocation),
+        "The following options are incompatible, cannot be used together: "
+        "MsgRecycling, InPlaceAllocation");
+
+    static_assert((!ParsedOptionsInternal::HasMsgRecycling) || (!Factory::ParsedOptions::HasSupportGenericMessage),
+        "The following options are incompatible, cannot be used together: "
+        "MsgRecycling, SupportGenericMessage");
+
+    friend class details::FlatProtocolStackHelper;
+
 public:
 
     /// @brief Parsed options
@@ -160,7 +181,13 @@ public:
     ///     @b NOTE, that @b msg parameter can be either reference to a smart pointer,
     ///     which will hold allocated object, or to previously allocated object itself.
     ///     In case of the latter, the function will compare read and expected message
-    ///     ID value and will return @ref comms::ErrorStatus::InvalidMsgId in case of mismatch.
+    ///     ID value and will return @ref comms::ErrorStatus::InvalidMsgId in case of mismatch.@n
+    ///     When the message object is allocated (and the
+    ///     @ref comms::option::app::SupportGenericMessage option is not used),
+    ///     the remaining size is checked against the minimal serialisation
+    ///     length of the messages with the read ID, and
+    ///     @ref comms::ErrorStatus::NotEnoughData is reported without allocating
+    ///     the message object when there is not enough data.
     /// @tparam TMsg Type of the @b msg parameter
     /// @tparam TIter Type of iterator used for reading.
     /// @tparam TNextLayerReader next layer reader object type.
@@ -207,22 +234,13 @@ public:
         }
 
         auto fieldLen = static_cast<std::size_t>(std::distance(beforeReadIter, iter));
-
-        using Tag =
-            typename std::conditional<
-                comms::isMessageBase<typename std::decay<decltype(msg)>::type>(),
-                DirectOpTag,
-                PointerOpTag
-            >::type;
-
         return
-            doReadInternal(
+            readAfterField(
                 field,
                 msg,
                 iter,
                 size - fieldLen,
                 std::forward<TNextLayerReader>(nextLayerReader),
-                Tag(),
                 extraValues...);
     }
 
@@ -298,6 +316,28 @@ public:
         return factory_.createMsg(id, idx, reason);
     }
 
+    /// @brief Release message object, which is not needed any more.
+    /// @details When @ref comms::option::app::MsgRecycling option is used,
+    ///     the object is kept inside the layer and reused during the next
+    ///     read of the message of the same type instead of allocating a new one.
+    ///     Only the last released object of every type is kept. Objects of the
+    ///     types that share their numeric ID with other messages are
+    ///     simply destructed, because their exact type cannot be determined
+    ///     from the ID. Note, that the objects discarded internally by the
+    ///     @ref read() operation when the message of one of such types fails to be
+    ///     read (and the next type with the same ID is tried) are
+    ///     kept, because their exact type is known. Without the
+    ///     @ref comms::option::app::MsgRecycling option the object is always destructed.
+    /// @param[in] msg Smart pointer to message object previously allocated
+    ///     by this layer.
+    /// @pre When @ref comms::option::app::MsgRecycling option is used, the message
+    ///     interface class must expose polymorphic ID retrieval functionality,
+    ///     see @ref comms::option::app::IdInfoInterface.
+    void recycleMsg(MsgPtr&& msg)
+    {
+        recycleMsgInternal(std::move(msg), MsgRecycleTag());
+    }
+
     /// @brief Compile time inquiry whether polymorphic dispatch tables are 
     ///     generated internally to map message ID to actual type.
     static constexpr bool isDispatchPolymorphic()
@@ -319,6 +359,14 @@ public:
         return Factory::isDispatchLinearSwitch();
     }
 
+    /// @brief Compile time inquiry whether the message objects released
+    ///     using @ref recycleMsg() are reused, i.e. the
+    ///     @ref comms::option::app::MsgRecycling option is used.
+    static constexpr bool hasMsgRecycling()
+    {
+        return ParsedOptionsInternal::HasMsgRecycling;
+    }
+
 protected:
 
     /// @brief Retrieve message id from the field.
@@ -395,6 +443,28 @@ private:
     struct HasGenericMsgTag {};
     struct NoGenericMsgTag {};
 
+    struct PayloadSizeCheckTag {};
+    struct NoPayloadSizeCheckTag {};
+
+    struct RecycleTag {};
+    struct NoRecycleTag {};
+
+    using MsgRecycleTag =
+        typename std::conditional<
+            ParsedOptionsInternal::HasMsgRecycling,
+            RecycleTag,
+            NoRecycleTag
+        >::type;
+
+    using MsgCache =
+        typename std::conditional<
+            ParsedOptionsInternal::HasMsgRecycling,
+            details::MsgIdLayerMsgCache<AllMessages, MsgPtr>,
+            details::MsgIdLayerNoMsgCache
+        >::type;
+
+    using MsgLengthBoundsTable = details::MsgLengthBoundsTable<MsgIdType, TAllMessages>;
+
     template <typename TIter, typename TNextLayerReader, typename... TExtraValues>
     class ReadRedirectionHandler
     {
@@ -584,6 +654,33 @@ private:
         return msg.doGetId();
     }
 
+    template <typename TMsg, typename TIter, typename TNextLayerReader, typename... TExtraValues>
+    comms::ErrorStatus readAfterField(
+        Field& field,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerReader&& nextLayerReader,
+        TExtraValues... extraValues)
+    {
+        using Tag =
+            typename std::conditional<
+                comms::isMessageBase<typename std::decay<decltype(msg)>::type>(),
+                DirectOpTag,
+                PointerOpTag
+            >::type;
+
+        return
+            doReadInternal(
+                field,
+                msg,
+                iter,
+                size,
+                std::forward<TNextLayerReader>(nextLayerReader),
+                Tag(),
+                extraValues...);
+    }
+
     template <typename TMsg, typename TIter, typename TNextLayerReader, typename... TExtraValues>
     comms::ErrorStatus doReadInternalDirect(
         Field& field,
@@ -674,12 +771,37 @@ private:
         const auto id = static_cast<ExtendingClass*>(this)->getMsgIdFromField(field);
         BaseImpl::setMsgId(id, extraValues...);
 
+        using GenericMsgTag =
+            typename std::conditional<
+                Factory::ParsedOptions::HasSupportGenericMessage,
+                HasGenericMsgTag,
+                NoGenericMsgTag
+            >::type;
+
+        // The minimal length of the message is only known to be a minimal
+        // length of the payload when the next layer is MsgDataLayer. Other
+        // layers (such as DeltaLayer) may legitimately transmit less.
+        using PayloadCheckTag =
+            typename std::conditional<
+                (!Factory::ParsedOptions::HasSupportGenericMessage) &&
+                    comms::protocol::isMsgDataLayer<TNextLayer>(),
+                PayloadSizeCheckTag,
+                NoPayloadSizeCheckTag
+            >::type;
+
+        std::size_t missingSize = 0U;
+        if (!isPayloadSizePossible(id, size, missingSize, PayloadCheckTag())) {
+            BaseImpl::setMsgIndex(0U, extraValues...);
+            BaseImpl::setMissingSize(missingSize, extraValues...);
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
         auto es = comms::ErrorStatus::InvalidMsgId;
         unsigned idx = 0;
         CreateFailureReason failureReason = CreateFailureReason::None;
         while (true) {
             COMMS_ASSERT(!msg);
-            msg = createMsgInternal(id, idx, &failureReason);
+            msg = createMsgForReadInstrumented(id, idx, &failureReason, comms::details::InstrumentationTag<MsgPtr>());
             if (!msg) {
                 break;
             }
@@ -696,7 +818,7 @@ private:
                 return es;
             }
 
-            msg.reset();
+            discardMsg(id, idx, msg, MsgRecycleTag());
             iter = readStart;
             ++idx;
         }
@@ -708,13 +830,6 @@ private:
         }        
         
         COMMS_ASSERT(failureReason == CreateFailureReason::InvalidId);
-        using GenericMsgTag = 
-            typename std::conditional<
-                Factory::ParsedOptions::HasSupportGenericMessage,
-                HasGenericMsgTag,
-                NoGenericMsgTag
-            >::type;
-
         return createAndReadGenericMsgInternal(
             field, 
             idx,
@@ -747,6 +862,30 @@ private:
         return comms::dispatchMsgStaticBinSearch<AllMessages>(id, idx, *msg, handler);
     }
 
+    template <typename TId>
+    static bool isPayloadSizePossible(TId&& id, std::size_t size, std::size_t& missingSize, PayloadSizeCheckTag)
+    {
+        // Reject too short payload before allocation of the message object
+        std::size_t minLen = 0U;
+        std::size_t maxLen = 0U;
+        if ((!MsgLengthBoundsTable::lookup(std::forward<TId>(id), minLen, maxLen)) ||
+            (minLen <= size)) {
+            return true;
+        }
+
+        missingSize = minLen - size;
+        return false;
+    }
+
+    template <typename TId>
+    static bool isPayloadSizePossible(TId&& id, std::size_t size, std::size_t& missingSize, NoPayloadSizeCheckTag)
+    {
+        static_cast<void>(id);
+        static_cast<void>(size);
+        static_cast<void>(missingSize);
+        return true;
+    }
+
     template <typename TId>
     MsgPtr createMsgInternalTagged(TId&& id, unsigned idx, CreateFailureReason* reason, IdParamAsIsTag)
     {
@@ -766,6 +905,78 @@ private:
         return createMsgInternalTagged(std::forward<TId>(id), idx, reason, IdParamTag<IdType>());
     }
 
+    template <typename TId>
+    MsgPtr createMsgForRead(TId&& id, unsigned idx, CreateFailureReason* reason, NoRecycleTag)
+    {
+        return createMsgInternal(std::forward<TId>(id), idx, reason);
+    }
+
+    template <typename TId>
+    MsgPtr createMsgForRead(TId&& id, unsigned idx, CreateFailureReason* reason, RecycleTag)
+    {
+        auto msg = msgCache_.take(id, idx);
+        if (msg) {
+            return msg;
+        }
+
+        return createMsgInternal(std::forward<TId>(id), idx, reason);
+    }
+
+    template <typename TId>
+    MsgPtr createMsgForReadInstrumented(TId&& id, unsigned idx, CreateFailureReason* reason, comms::details::NotInstrumentedTag)
+    {
+        return createMsgForRead(std::forward<TId>(id), idx, reason, MsgRecycleTag());
+    }
+
+    template <typename TId>
+    MsgPtr createMsgForReadInstrumented(TId&& id, unsigned idx, CreateFailureReason* reason, comms::details::InstrumentedTag)
+    {
+        using Policy = comms::details::InstrumentationPolicyT<MsgPtr>;
+        auto start = Policy::template msgCreateBegin<ExtendingClass>(id);
+        auto msg = createMsgForRead(id, idx, reason, MsgRecycleTag());
+        Policy::template msgCreateEnd<ExtendingClass>(start, id, static_cast<bool>(msg));
+        return msg;
+    }
+
+    template <typename TMsg, typename TTag>
+    static void discardMsg(MsgIdParamType id, unsigned idx, TMsg& msg, TTag)
+    {
+        static_cast<void>(id);
+        static_cast<void>(idx);
+        msg.reset();
+    }
+
+    void discardMsg(MsgIdParamType id, unsigned idx, MsgPtr& msg, RecycleTag)
+    {
+        msgCache_.put(id, idx, std::move(msg));
+        msg.reset();
+    }
+
+    void recycleMsgInternal(MsgPtr&& msg, NoRecycleTag)
+    {
+        msg.reset();
+    }
+
+    void recycleMsgInternal(MsgPtr&& msg, RecycleTag)
+    {
+        static_assert(Message::InterfaceOptions::HasMsgIdInfo,
+            "The message interface class must expose polymorphic ID retrieval functionality, "
+            "use comms::option::app::IdInfoInterface option to define it.");
+
+        if (!msg) {
+            return;
+        }
+
+        auto id = msg->getId();
+        if (msgCountInternal(id) != 1U) {
+            msg.reset();
+            return;
+        }
+
+        msgCache_.put(id, 0U, std::move(msg));
+        msg.reset();
+    }
+
     template <typename TId>
     MsgPtr createGenericMsgInternalTagged(TId&& id, unsigned idx, IdParamAsIsTag)
     {
@@ -920,7 +1131,7 @@ private:
     }
 
     Factory factory_;
-
+    MsgCache msgCache_;
 };
 
 
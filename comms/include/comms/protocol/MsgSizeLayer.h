@@ -22,6 +22,7 @@
 #include "comms/field/IntValue.h"
 #include "comms/protocol/ProtocolLayerBase.h"
 #include "comms/protocol/details/MsgSizeLayerOptionsParser.h"
+#include "comms/protocol/details/MsgLengthBoundsTable.h"
 #include "comms/protocol/details/ProtocolLayerExtendingClassHelper.h"
 
 namespace comms
@@ -32,6 +33,8 @@ namespace protocol
 
 namespace details
 {
+class FlatProtocolStackHelper;
+
 template <bool TValidPtr>
 struct MsgSizeLayerConstNullPtrCastHelper;
 
@@ -62,6 +65,9 @@ struct MsgSizeLayerConstNullPtrCastHelper<false>
 ///     @li  @ref comms::option::ExtendingClass - Use this option to provide a class
 ///         name of the extending class, which can be used to extend existing functionality.
 ///         See also @ref page_custom_size_layer tutorial page.
+///     @li @ref comms::option::def::MsgSizeLayerVerifyLengthBounds - Use this option
+///         to reject frames, reported size of which is outside the possible
+///         serialisation length range of the known messages.
 /// @headerfile comms/protocol/MsgSizeLayer.h
 template <typename TField, typename TNextLayer, typename... TOptions>
 class MsgSizeLayer : public
@@ -89,7 +95,14 @@ class MsgSizeLayer : public
             comms::option::ProtocolLayerDisallowReadUntilDataSplit
         >;
 
+    using ParsedOptionsInternal = details::MsgSizeLayerOptionsParser<TOptions...>;
+
+    friend class details::FlatProtocolStackHelper;
+
 public:
+    /// @brief Parsed options
+    using ParsedOptions = ParsedOptionsInternal;
+
     /// @brief Type of the field object used to read/write remaining size value.
     using Field = typename BaseImpl::Field;
 
@@ -135,6 +148,12 @@ public:
     ///          However, if buffer contains enough data, but the next layer
     ///          reports it's not enough (returns comms::ErrorStatus::NotEnoughData),
     ///          comms::ErrorStatus::ProtocolError will be returned.
+    ///          When @ref comms::option::def::MsgSizeLayerVerifyLengthBounds
+    ///          option is used, the reported size is also checked against the
+    ///          minimal and maximal serialisation length of all the known
+    ///          messages, and comms::ErrorStatus::ProtocolError is reported
+    ///          immediately for the impossible values (without allocation
+    ///          of the message object).
     /// @tparam TMsg Type of @b msg parameter.
     /// @tparam TIter Type of iterator used for reading.
     /// @tparam TNextLayerReader next layer reader object type.
@@ -182,38 +201,15 @@ public:
             return es;
         }
 
-        auto fromIter = iter;
         auto readFieldLength = static_cast<std::size_t>(std::distance(begIter, iter));
-        std::size_t actualRemainingSize = (size - readFieldLength);
-        std::size_t requiredRemainingSize = 
-            static_cast<ExtendingClass*>(this)->getRemainingSizeFromField(field);
-
-        if (actualRemainingSize < requiredRemainingSize) {
-            BaseImpl::setMissingSize(requiredRemainingSize - actualRemainingSize, extraValues...);
-            return ErrorStatus::NotEnoughData;
-        }
-
-        using MsgType = typename std::decay<decltype(msg)>::type;
-        using MsgPtrTag = MsgTypeTag<MsgType>;
-        static_cast<ExtendingClass*>(this)->beforeRead(field, getPtrToMsgInternal(msg, MsgPtrTag()));
-        es = nextLayerReader.read(msg, iter, requiredRemainingSize, extraValues...);
-        if (es == ErrorStatus::NotEnoughData) {
-            BaseImpl::resetMsg(msg);
-            return ErrorStatus::ProtocolError;
-        }
-
-        if (es != ErrorStatus::ProtocolError) {
-            iter = fromIter;
-            std::advance(iter, requiredRemainingSize);
-        }
-
-        auto consumed =
-            static_cast<std::size_t>(std::distance(fromIter, iter));
-        if (consumed < requiredRemainingSize) {
-            auto diff = requiredRemainingSize - consumed;
-            std::advance(iter, diff);
-        }
-        return es;
+        return
+            readAfterField(
+                field,
+                msg,
+                iter,
+                size - readFieldLength,
+                std::forward<TNextLayerReader>(nextLayerReader),
+                extraValues...);
     }
 
 
@@ -339,6 +335,93 @@ protected:
 
 private:
 
+    struct VerifyLengthBoundsTag {};
+    struct NoVerifyLengthBoundsTag {};
+
+    using LengthBoundsTag =
+        typename std::conditional<
+            ParsedOptionsInternal::HasVerifyLengthBounds,
+            VerifyLengthBoundsTag,
+            NoVerifyLengthBoundsTag
+        >::type;
+
+    template <typename TMsg, typename TIter, typename TNextLayerReader, typename... TExtraValues>
+    comms::ErrorStatus readAfterField(
+        Field& field,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerReader&& nextLayerReader,
+        TExtraValues... extraValues)
+    {
+        auto fromIter = iter;
+        std::size_t requiredRemainingSize =
+            static_cast<ExtendingClass*>(this)->getRemainingSizeFromField(field);
+
+        if (!isRemainingSizePossible(requiredRemainingSize)) {
+            return ErrorStatus::ProtocolError;
+        }
+
+        if (size < requiredRemainingSize) {
+            BaseImpl::setMissingSize(requiredRemainingSize - size, extraValues...);
+            return ErrorStatus::NotEnoughData;
+        }
+
+        using MsgType = typename std::decay<decltype(msg)>::type;
+        using MsgPtrTag = MsgTypeTag<MsgType>;
+        static_cast<ExtendingClass*>(this)->beforeRead(field, getPtrToMsgInternal(msg, MsgPtrTag()));
+        auto es = nextLayerReader.read(msg, iter, requiredRemainingSize, extraValues...);
+        if (es == ErrorStatus::NotEnoughData) {
+            BaseImpl::resetMsg(msg);
+            return ErrorStatus::ProtocolError;
+        }
+
+        if (es != ErrorStatus::ProtocolError) {
+            iter = fromIter;
+            std::advance(iter, requiredRemainingSize);
+        }
+
+        auto consumed =
+            static_cast<std::size_t>(std::distance(fromIter, iter));
+        if (consumed < requiredRemainingSize) {
+            auto diff = requiredRemainingSize - consumed;
+            std::advance(iter, diff);
+        }
+        return es;
+    }
+
+    static bool isRemainingSizePossible(std::size_t size)
+    {
+        return isRemainingSizePossibleInternal(size, LengthBoundsTag());
+    }
+
+    static bool isRemainingSizePossibleInternal(std::size_t size, NoVerifyLengthBoundsTag)
+    {
+        static_cast<void>(size);
+        return true;
+    }
+
+    static bool isRemainingSizePossibleInternal(std::size_t size, VerifyLengthBoundsTag)
+    {
+        using MsgLengthBounds = details::MsgLengthBoundsGlobal<typename BaseImpl::AllMessages>;
+        using NextLayerFields = typename TNextLayer::AllFields;
+        static_assert(0U < std::tuple_size<NextLayerFields>::value, "Unexpected fields of the next layer");
+
+        // The last field belongs to MsgDataLayer and represents the message payload
+        static const std::size_t TransportFieldsCount = std::tuple_size<NextLayerFields>::value - 1;
+        static const std::size_t MinSize =
+            comms::util::tupleTypeAccumulateFromUntil<0, TransportFieldsCount, NextLayerFields>(
+                MsgLengthBounds::Min,
+                details::MsgLengthBoundsFieldMinLengthRetriever());
+
+        static const std::size_t MaxSize =
+            comms::util::tupleTypeAccumulateFromUntil<0, TransportFieldsCount, NextLayerFields>(
+                MsgLengthBounds::Max,
+                details::MsgLengthBoundsFieldMaxLengthRetriever());
+
+        return (MinSize <= size) && (size <= MaxSize);
+    }
+
     using FixedLengthTag = typename BaseImpl::FixedLengthTag;
     using VarLengthTag = typename BaseImpl::VarLengthTag;
     using LengthTag = typename BaseImpl::LengthTag;
@@ -562,8 +645,8 @@ struct MsgSizeLayerCheckHelper
     static const bool Value = false;
 };
 
-template <typename TField, typename TNextLayer>
-struct MsgSizeLayerCheckHelper<MsgSizeLayer<TField, TNextLayer> >
+template <typename TField, typename TNextLayer, typename... TOptions>
+struct MsgSizeLayerCheckHelper<MsgSizeLayer<TField, TNextLayer, TOptions...> >
 {
     static const bool Value = true;
 };
@@ -31,6 +31,7 @@
 #include "comms/protocol/details/ProtocolLayerDetails.h"
 #include "comms/details/protocol_layers_access.h"
 #include "comms/details/detect.h"
+#include "comms/details/InstrumentationHelper.h"
 
 namespace comms
 {
@@ -204,6 +205,11 @@ public:
     ///       advanced will pinpoint the location of the error.
     /// @post Returns comms::ErrorStatus::Success if and only if msg points
     ///       to a valid object.
+    /// @post Messages left pending by the inner @ref comms::protocol::MsgBatchLayer
+    ///       are discarded when the read is not successful (see @ref discardPendingMsgs()).
+    /// @post The state updated by the stateful inner layers (such as
+    ///       @ref comms::protocol::DeltaLayer) is committed when the whole frame
+    ///       is read successfully and rolled back otherwise (see @ref beginFrameRead()).
     template <typename TMsg, typename TIter, typename... TExtraValues>
     comms::ErrorStatus read(
         TMsg& msg,
@@ -220,7 +226,13 @@ public:
 
         static_assert(std::is_same<Tag, NormalReadTag>::value || canSplitRead(),
             "Read split is disallowed by at least one of the inner layers");
-        return readInternal(msg, iter, size, Tag(), extraValues...);
+        thisLayer().beginFrameRead();
+        auto es = readInstrumented(msg, iter, size, Tag(), comms::details::InstrumentationTag<TMsg>(), extraValues...);
+        if (es != comms::ErrorStatus::Success) {
+            discardPendingMsgs();
+        }
+        thisLayer().endFrameRead(es);
+        return es;
     }
 
     /// @brief Perform read of data fields until data layer (message payload).
@@ -239,6 +251,7 @@ public:
     ///     @li @ref comms::protocol::msgId()
     ///     @li @ref comms::protocol::msgIndex()
     ///     @li @ref comms::protocol::msgPayload()
+    ///     @li @ref comms::protocol::readStatistics()
     /// @return Status of the operation.
     /// @pre Iterator must be valid and can be dereferenced and incremented at
     ///      least "size" times;
@@ -283,6 +296,7 @@ public:
     ///     @li @ref comms::protocol::msgId()
     ///     @li @ref comms::protocol::msgIndex()
     ///     @li @ref comms::protocol::msgPayload()
+    ///     @li @ref comms::protocol::readStatistics()
     /// @return Status of the operation.
     /// @pre Iterator must be valid and can be dereferenced and incremented at
     ///      least "size" times;
@@ -323,6 +337,7 @@ public:
     ///     @li @ref comms::protocol::msgId()
     ///     @li @ref comms::protocol::msgIndex()
     ///     @li @ref comms::protocol::msgPayload()
+    ///     @li @ref comms::protocol::readStatistics()
     /// @return Status of the operation.
     template <typename TAllFields, typename TMsg, typename TIter, typename... TExtraValues>
     comms::ErrorStatus readFieldsCached(
@@ -339,7 +354,8 @@ public:
                                 std::tuple_size<AllFields>::value;
         auto& field = getField<Idx>(allFields);
         auto& derivedObj = static_cast<TDerived&>(*this);
-        return
+        thisLayer().beginFrameRead();
+        auto es =
             derivedObj.doRead(
                 field,
                 msg,
@@ -347,6 +363,11 @@ public:
                 size,
                 createNextLayerCachedFieldsReader(allFields),
                 extraValues...);
+        if (es != comms::ErrorStatus::Success) {
+            discardPendingMsgs();
+        }
+        thisLayer().endFrameRead(es);
+        return es;
     }
 
     /// @brief Perform read of data fields until data layer (message payload) while caching
@@ -373,6 +394,7 @@ public:
     ///     @li @ref comms::protocol::msgId()
     ///     @li @ref comms::protocol::msgIndex()
     ///     @li @ref comms::protocol::msgPayload()
+    ///     @li @ref comms::protocol::readStatistics()
     /// @return Status of the operation.
     template <typename TAllFields, typename TMsg, typename TIter, typename... TExtraValues>
     comms::ErrorStatus readUntilDataFieldsCached(
@@ -422,6 +444,7 @@ public:
     ///     @li @ref comms::protocol::msgId()
     ///     @li @ref comms::protocol::msgIndex()
     ///     @li @ref comms::protocol::msgPayload()
+    ///     @li @ref comms::protocol::readStatistics()
     /// @return Status of the operation.
     template <typename TAllFields, typename TMsg, typename TIter, typename... TExtraValues>
     comms::ErrorStatus readFromDataFieldsCached(
@@ -479,9 +502,10 @@ public:
         TIter& iter,
         std::size_t size) const
     {
-        Field field;
-        auto& derivedObj = static_cast<const TDerived&>(*this);
-        return derivedObj.doWrite(field, msg, iter, size, createNextLayerWriter());
+        thisLayer().beginFrameWrite();
+        auto es = writeInstrumented(msg, iter, size, comms::details::InstrumentationTag<TMsg>());
+        thisLayer().endFrameWrite(es);
+        return es;
     }
 
     /// @brief Serialise message into output data sequence while caching the written transport
@@ -516,7 +540,10 @@ public:
 
         auto& field = getField<Idx>(allFields);
         auto& derivedObj = static_cast<const TDerived&>(*this);
-        return derivedObj.doWrite(field, msg, iter, size, createNextLayerCachedFieldsWriter(allFields));
+        thisLayer().beginFrameWrite();
+        auto es = derivedObj.doWrite(field, msg, iter, size, createNextLayerCachedFieldsWriter(allFields));
+        thisLayer().endFrameWrite(es);
+        return es;
     }
 
     /// @brief Get remaining length of wrapping transport information.
@@ -719,6 +746,118 @@ public:
         return nextLayer().createMsg(std::forward<TId>(id), idx);
     }
 
+    /// @brief Release message object, which is not needed any more.
+    /// @details The default implementation is to forwards this call to the next
+    ///     layer. One of the layers (usually comms::protocol::MsgIdLayer)
+    ///     hides and overrides this implementation.
+    /// @tparam TMsgPtr Type of the smart pointer to message object.
+    /// @param msg Smart pointer to message object previously allocated by
+    ///     the protocol stack.
+    template <typename TMsgPtr>
+    void recycleMsg(TMsgPtr&& msg)
+    {
+        nextLayer().recycleMsg(std::forward<TMsgPtr>(msg));
+    }
+
+    /// @brief Compile time inquiry whether the message objects released
+    ///     using @ref recycleMsg() are reused.
+    /// @details The default implementation is to forward this inquiry to the
+    ///     next layer. The @ref comms::protocol::MsgIdLayer hides and overrides
+    ///     this implementation.
+    static constexpr bool hasMsgRecycling()
+    {
+        return NextLayer::hasMsgRecycling();
+    }
+
+    /// @brief Compile time check whether every frame can be decoded on its
+    ///     own, i.e. the result of the read doesn't depend on previously
+    ///     read frames.
+    /// @details The default implementation is to forward this inquiry to the
+    ///     next layer. The @ref comms::protocol::MsgBatchLayer and
+    ///     @ref comms::protocol::DeltaLayer hide and override
+    ///     this implementation.
+    static constexpr bool isFrameSelfContained()
+    {
+        return NextLayer::isFrameSelfContained();
+    }
+
+    /// @brief Check whether there are messages left from the recently read
+    ///     batch of messages.
+    /// @details The default implementation is to forwards this call to the next
+    ///     layer. The @ref comms::protocol::MsgBatchLayer hides and overrides
+    ///     this implementation.
+    bool hasPendingMsg() const
+    {
+        return nextLayer().hasPendingMsg();
+    }
+
+    /// @brief Retrieve the message left from the recently read batch of messages.
+    /// @details The default implementation is to forwards this call to the next
+    ///     layer. The @ref comms::protocol::MsgBatchLayer hides and overrides
+    ///     this implementation.
+    /// @param[out] msg Smart pointer to receive the message object.
+    /// @param[out] extraValues Extra output parameters provided using
+    ///     @ref comms::protocol::msgId() and / or @ref comms::protocol::msgIndex().
+    /// @return @b true in case the message object has been retrieved,
+    ///     @b false if there are no pending messages.
+    template <typename TMsg, typename... TExtraValues>
+    bool takePendingMsg(TMsg& msg, TExtraValues... extraValues)
+    {
+        return nextLayer().takePendingMsg(msg, extraValues...);
+    }
+
+    /// @brief Discard messages left from the recently read batch of messages.
+    /// @details Invoked by @ref read() when any of the layers rejects the
+    ///     frame, so the messages of the rejected batch are never dispatched.
+    ///     The default implementation is to forwards this call to the next
+    ///     layer. The @ref comms::protocol::MsgBatchLayer hides and overrides
+    ///     this implementation.
+    void discardPendingMsgs()
+    {
+        nextLayer().discardPendingMsgs();
+    }
+
+    /// @brief Notify the layers about the beginning of the read operation.
+    /// @details Invoked by @ref read() and @ref readFieldsCached() of every
+    ///     layer, i.e. the nested calls are expected. Together with
+    ///     @ref endFrameRead() allows stateful layers (such as
+    ///     @ref comms::protocol::DeltaLayer) to apply their state updates only
+    ///     when the whole frame is accepted by all the wrapping layers.
+    ///     The default implementation is to forwards this call to the next
+    ///     layer.
+    void beginFrameRead()
+    {
+        nextLayer().beginFrameRead();
+    }
+
+    /// @brief Notify the layers about the end of the read operation.
+    /// @details Counterpart of @ref beginFrameRead().
+    ///     The default implementation is to forwards this call to the next
+    ///     layer.
+    /// @param[in] es Status of the read operation.
+    void endFrameRead(comms::ErrorStatus es)
+    {
+        nextLayer().endFrameRead(es);
+    }
+
+    /// @brief Notify the layers about the beginning of the write operation.
+    /// @details Same as @ref beginFrameRead(), but invoked by @ref write()
+    ///     and @ref writeFieldsCached().
+    void beginFrameWrite() const
+    {
+        nextLayer().beginFrameWrite();
+    }
+
+    /// @brief Notify the layers about the end of the write operation.
+    /// @details Counterpart of @ref beginFrameWrite(). The write
+    ///     is considered to be successful when @b es is either
+    ///     comms::ErrorStatus::Success or comms::ErrorStatus::UpdateRequired.
+    /// @param[in] es Status of the write operation.
+    void endFrameWrite(comms::ErrorStatus es) const
+    {
+        nextLayer().endFrameWrite(es);
+    }
+
     /// @brief Access appropriate field from "cached" bundle of all the
     ///     protocol stack fields.
     /// @param allFields All fields of the protocol stack
@@ -839,6 +978,19 @@ protected:
         return setMsgIndexInternal(val, extraValues...);
     }
 
+    /// @brief Report checksum mismatch to the statistics collector if such
+    ///     is requested.
+    /// @details Updates the collector reference to which was passed to the
+    ///     "read" operation using @ref comms::protocol::readStatistics().
+    /// @param[out] extraValues Variadic parameters passed to the
+    ///     "read" function such as @ref comms::protocol::ProtocolLayerBase::read() "read()"
+    ///     or @ref comms::protocol::ProtocolLayerBase::readFieldsCached() "readFieldsCached()"
+    template <typename... TExtraValues>
+    void reportChecksumFailure(TExtraValues... extraValues) const
+    {
+        details::ReadStatisticsReporter::checksumFailure(extraValues...);
+    }
+
     /// @brief Retrieve reference to a layer specific field out of
     ///     all fields.
     /// @tparam TIdx Index of the field in tuple
@@ -1105,6 +1257,70 @@ private:
     struct MessageObjTag {};
     struct SmartPtrTag {};
 
+    template <typename TMsg, typename TIter, typename TReadTag, typename... TExtraValues>
+    comms::ErrorStatus readInstrumented(
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TReadTag,
+        comms::details::NotInstrumentedTag,
+        TExtraValues... extraValues)
+    {
+        return readInternal(msg, iter, size, TReadTag(), extraValues...);
+    }
+
+    template <typename TMsg, typename TIter, typename TReadTag, typename... TExtraValues>
+    comms::ErrorStatus readInstrumented(
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TReadTag,
+        comms::details::InstrumentedTag,
+        TExtraValues... extraValues)
+    {
+        using Policy = comms::details::InstrumentationPolicyT<TMsg>;
+        auto start = Policy::template layerReadBegin<TDerived>();
+        auto fromIter = iter;
+        auto es = readInternal(msg, iter, size, TReadTag(), extraValues...);
+        Policy::template layerReadEnd<TDerived>(
+            start,
+            msg,
+            static_cast<std::size_t>(std::distance(fromIter, iter)),
+            es);
+        return es;
+    }
+
+    template <typename TMsg, typename TIter>
+    comms::ErrorStatus writeInstrumented(
+        const TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        comms::details::NotInstrumentedTag) const
+    {
+        Field field;
+        auto& derivedObj = static_cast<const TDerived&>(*this);
+        return derivedObj.doWrite(field, msg, iter, size, createNextLayerWriter());
+    }
+
+    template <typename TMsg, typename TIter>
+    comms::ErrorStatus writeInstrumented(
+        const TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        comms::details::InstrumentedTag) const
+    {
+        using Policy = comms::details::InstrumentationPolicyT<TMsg>;
+        auto start = Policy::template layerWriteBegin<TDerived>();
+        auto fromIter = iter;
+        auto es = writeInstrumented(msg, iter, size, comms::details::NotInstrumentedTag());
+        Policy::template layerWriteEnd<TDerived>(
+            start,
+            msg,
+            comms::details::InstrumentationHelper::distance(fromIter, iter),
+            es);
+        return es;
+    }
+
     template <typename TMsg, typename TIter, typename... TExtraValues>
     comms::ErrorStatus readInternal(
         TMsg& msg,
@@ -1479,6 +1695,34 @@ details::MsgPayloadRetriever<TIter> msgPayload(TIter& iter, std::size_t& len)
     return details::MsgPayloadRetriever<TIter>(iter, len);
 }
 
+/// @brief Add "read statistics" collector to protocol stack's (frame's)
+///     "read" operation.
+/// @details Can be passed as variadic parameters to "read" functions
+///     of protocol stack (see @ref comms::protocol::ProtocolLayerBase::read()
+///     and @ref  comms::protocol::ProtocolLayerBase::readFieldsCached())
+///     as well as to the process helper functions (see @ref page_dispatch).
+///     The layers report checksum mismatches, while the process helper
+///     functions report successfully read frames, number of bytes skipped
+///     during re-synchronisation and some of the returned error statuses.
+///     @code
+///     using ProtocolStack = ...
+///     ProtocolStack stack;
+///     comms::protocol::ReadStatistics<> stats;
+///     auto consumed =
+///         comms::processAllWithDispatch(
+///             readIter, size, stack, handler, comms::protocol::readStatistics(stats));
+///     @endcode
+/// @param[out] stats Reference to the statistics collector object, usually
+///     a variant of @ref comms::protocol::ReadStatistics.
+/// @return Implementation dependent object accepted by "read" functions.
+/// @see @ref comms::protocol::ProtocolLayerBase::read()
+/// @see @ref comms::protocol::ProtocolLayerBase::readFieldsCached()
+template <typename TStats>
+details::ReadStatisticsRetriever<TStats> readStatistics(TStats& stats)
+{
+    return details::ReadStatisticsRetriever<TStats>(stats);
+}
+
 }  // namespace protocol
 
 }  // namespace comms
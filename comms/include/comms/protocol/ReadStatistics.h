@@ -0,0 +1,228 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of @ref comms::protocol::ReadStatistics
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <array>
+
+#include "comms/ErrorStatus.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+/// @brief Statistics collector of the protocol stack (frame) read operations.
+/// @details Passed to the "read" operation of the protocol stack or
+///     to the process helper functions using @ref comms::protocol::readStatistics().
+///     @code
+///     comms::protocol::ReadStatistics<> stats;
+///     auto consumed =
+///         comms::processAllWithDispatch(
+///             readIter, size, stack, handler, comms::protocol::readStatistics(stats));
+///     ...
+///     if (0U < stats.checksumFailures()) {
+///         ... // Report bad link quality
+///     }
+///     @endcode
+///     The collected values are:
+///     @li Number of successfully read frames per message ID, reported by
+///         the process helper functions (see @ref page_dispatch).
+///     @li Number of checksum mismatches, reported by @ref comms::protocol::ChecksumLayer
+///         and @ref comms::protocol::ChecksumPrefixLayer.
+///     @li Number of bytes skipped during re-synchronisation, reported by
+///         the process helper functions (see @ref page_dispatch).
+///     @li Number of @ref comms::ErrorStatus::MsgAllocFailure and
+///         @ref comms::ErrorStatus::InvalidMsgData statuses, reported by the
+///         process helper functions.
+///
+///     All the counters are updated using relaxed atomic operations, which
+///     allows reading them from another thread.
+/// @tparam TIdsCount Number of numeric message IDs (starting from 0) that
+///     have a dedicated frames counter. Frames of the messages with greater
+///     numeric IDs are accumulated in a single counter (see @ref framesOfOtherIds()).
+/// @headerfile comms/protocol/ReadStatistics.h
+template <std::size_t TIdsCount = 256U>
+class ReadStatistics
+{
+public:
+    /// @brief Type of the counters
+    using CounterType = std::size_t;
+
+    /// @brief Default constructor, zeroes all the counters.
+    ReadStatistics()
+    {
+        reset();
+    }
+
+    /// @brief Copy constructor is deleted
+    ReadStatistics(const ReadStatistics&) = delete;
+
+    /// @brief Copy assignment is deleted
+    ReadStatistics& operator=(const ReadStatistics&) = delete;
+
+    /// @brief Number of numeric message IDs having dedicated frames counter.
+    static constexpr std::size_t idsCount()
+    {
+        return TIdsCount;
+    }
+
+    /// @brief Report successfully read frame.
+    template <typename TId>
+    void reportFrame(TId id)
+    {
+        increment(frameCounter(static_cast<std::uintmax_t>(id)));
+        increment(framesTotal_);
+    }
+
+    /// @brief Report bytes skipped during re-synchronisation.
+    void reportResyncBytes(std::size_t count)
+    {
+        increment(resyncBytes_, count);
+    }
+
+    /// @brief Report checksum mismatch.
+    void reportChecksumFailure()
+    {
+        increment(checksumFailures_);
+    }
+
+    /// @brief Report status of the read operation.
+    /// @details Only @ref comms::ErrorStatus::MsgAllocFailure and
+    ///     @ref comms::ErrorStatus::InvalidMsgData are counted, other
+    ///     statuses are ignored.
+    void reportReadStatus(comms::ErrorStatus es)
+    {
+        if (es == comms::ErrorStatus::MsgAllocFailure) {
+            increment(allocFailures_);
+            return;
+        }
+
+        if (es == comms::ErrorStatus::InvalidMsgData) {
+            increment(invalidMsgData_);
+        }
+    }
+
+    /// @brief Number of successfully read frames of the message with provided ID.
+    template <typename TId>
+    CounterType frames(TId id) const
+    {
+        return load(frameCounter(static_cast<std::uintmax_t>(id)));
+    }
+
+    /// @brief Total number of successfully read frames.
+    CounterType framesTotal() const
+    {
+        return load(framesTotal_);
+    }
+
+    /// @brief Number of successfully read frames of the messages with numeric
+    ///     ID not less than @ref idsCount().
+    CounterType framesOfOtherIds() const
+    {
+        return load(framesOfOtherIds_);
+    }
+
+    /// @brief Number of bytes skipped during re-synchronisation.
+    CounterType resyncBytes() const
+    {
+        return load(resyncBytes_);
+    }
+
+    /// @brief Number of checksum mismatches.
+    CounterType checksumFailures() const
+    {
+        return load(checksumFailures_);
+    }
+
+    /// @brief Number of @ref comms::ErrorStatus::MsgAllocFailure statuses.
+    CounterType allocFailures() const
+    {
+        return load(allocFailures_);
+    }
+
+    /// @brief Number of @ref comms::ErrorStatus::InvalidMsgData statuses.
+    CounterType invalidMsgData() const
+    {
+        return load(invalidMsgData_);
+    }
+
+    /// @brief Zero all the counters.
+    void reset()
+    {
+        for (auto& c : frames_) {
+            c.store(0U, std::memory_order_relaxed);
+        }
+
+        framesOfOtherIds_.store(0U, std::memory_order_relaxed);
+        framesTotal_.store(0U, std::memory_order_relaxed);
+        resyncBytes_.store(0U, std::memory_order_relaxed);
+        checksumFailures_.store(0U, std::memory_order_relaxed);
+        allocFailures_.store(0U, std::memory_order_relaxed);
+        invalidMsgData_.store(0U, std::memory_order_relaxed);
+    }
+
+private:
+    using Counter = std::atomic<CounterType>;
+
+    Counter& frameCounter(std::uintmax_t id)
+    {
+        if (id < TIdsCount) {
+            return frames_[static_cast<std::size_t>(id)];
+        }
+
+        return framesOfOtherIds_;
+    }
+
+    const Counter& frameCounter(std::uintmax_t id) const
+    {
+        if (id < TIdsCount) {
+            return frames_[static_cast<std::size_t>(id)];
+        }
+
+        return framesOfOtherIds_;
+    }
+
+    static void increment(Counter& counter, CounterType val = 1U)
+    {
+        counter.fetch_add(val, std::memory_order_relaxed);
+    }
+
+    static CounterType load(const Counter& counter)
+    {
+        return counter.load(std::memory_order_relaxed);
+    }
+
+    std::array<Counter, TIdsCount> frames_;
+    Counter framesOfOtherIds_;
+    Counter framesTotal_;
+    Counter resyncBytes_;
+    Counter checksumFailures_;
+    Counter allocFailures_;
+    Counter invalidMsgData_;
+};
+
+} // namespace protocol
+
+} // namespace comms
@@ -0,0 +1,264 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "comms/ErrorStatus.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace compression
+{
+
+/// @brief Dependency free LZ77 compression codec.
+/// @details Replaces repeated byte sequences with back references
+///     to the previously seen data (up to 64KB back). The compressed data
+///     uses the same sequence encoding as
+///     <a href="https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md">LZ4 block format</a>
+///     (without any frame headers), i.e. every sequence is a token byte,
+///     followed by literal bytes, 2 bytes little endian offset
+///     of the match, and optional extra bytes of the match length.
+///     Can be used as codec for @ref comms::protocol::CompressionLayer.
+/// @tparam THashLog Number of bits in the hash value used to find the
+///     matches. Influences the compression ratio and amount of memory
+///     (4 * 2^THashLog bytes) allocated during the compression.
+/// @headerfile comms/protocol/compression/Lz77.h
+template <unsigned THashLog = 12>
+class Lz77
+{
+    static_assert((8U <= THashLog) && (THashLog <= 20U), "Unexpected hash log value");
+
+public:
+    /// @brief Compress the data.
+    /// @param[in] data Pointer to the data to compress.
+    /// @param[in] len Length of the data.
+    /// @param[in, out] out Output container, the compressed data is appended to it.
+    /// @return comms::ErrorStatus::Success.
+    template <typename TOutput>
+    comms::ErrorStatus compress(const std::uint8_t* data, std::size_t len, TOutput& out) const
+    {
+        std::size_t anchor = 0U;
+        if (MinCompressLength <= len) {
+            std::vector<std::uint32_t> table(HashTableSize, 0U);
+            auto matchLimit = len - LastLiterals;
+            auto pos = std::size_t(0U);
+            while ((pos + MatchFindLimit) <= len) {
+                auto seq = read32(data + pos);
+                auto& entry = table[hash(seq)];
+                auto refPos = static_cast<std::size_t>(entry);
+                entry = static_cast<std::uint32_t>(pos + 1U);
+
+                if ((refPos == 0U) ||
+                    (MaxOffset < (pos - (refPos - 1U))) ||
+                    (read32(data + refPos - 1U) != seq)) {
+                    ++pos;
+                    continue;
+                }
+
+                auto matchPos = refPos - 1U;
+                auto matchLen = MinMatch;
+                while (((pos + matchLen) < matchLimit) &&
+                       (data[matchPos + matchLen] == data[pos + matchLen])) {
+                    ++matchLen;
+                }
+
+                writeSequence(data + anchor, pos - anchor, pos - matchPos, matchLen, out);
+                pos += matchLen;
+                anchor = pos;
+            }
+        }
+
+        writeLastLiterals(data + anchor, len - anchor, out);
+        return comms::ErrorStatus::Success;
+    }
+
+    /// @brief Decompress the data.
+    /// @param[in] data Pointer to the compressed data.
+    /// @param[in] len Length of the compressed data.
+    /// @param[in, out] out Output container, the decompressed data is appended to it.
+    /// @param[in] maxLen Maximal allowed length of the decompressed data.
+    /// @return comms::ErrorStatus::Success on success, comms::ErrorStatus::ProtocolError
+    ///     in case of malformed input or when the decompressed data exceeds @b maxLen.
+    template <typename TOutput>
+    comms::ErrorStatus decompress(
+        const std::uint8_t* data,
+        std::size_t len,
+        TOutput& out,
+        std::size_t maxLen = std::numeric_limits<std::size_t>::max()) const
+    {
+        auto outStart = out.size();
+        std::size_t pos = 0U;
+        while (pos < len) {
+            auto token = data[pos];
+            ++pos;
+
+            std::size_t litLen = static_cast<std::size_t>(token >> 4);
+            if (!readExtraLength(data, len, pos, litLen)) {
+                return comms::ErrorStatus::ProtocolError;
+            }
+
+            if (((len - pos) < litLen) ||
+                ((maxLen - (out.size() - outStart)) < litLen)) {
+                return comms::ErrorStatus::ProtocolError;
+            }
+
+            out.insert(out.end(), data + pos, data + pos + litLen);
+            pos += litLen;
+            if (pos == len) {
+                // Last sequence has literals only
+                return comms::ErrorStatus::Success;
+            }
+
+            if ((len - pos) < 2U) {
+                return comms::ErrorStatus::ProtocolError;
+            }
+
+            auto offset =
+                static_cast<std::size_t>(data[pos]) |
+                (static_cast<std::size_t>(data[pos + 1]) << 8);
+            pos += 2U;
+
+            if ((offset == 0U) || ((out.size() - outStart) < offset)) {
+                return comms::ErrorStatus::ProtocolError;
+            }
+
+            std::size_t matchLen = static_cast<std::size_t>(token & TokenMask);
+            if (!readExtraLength(data, len, pos, matchLen)) {
+                return comms::ErrorStatus::ProtocolError;
+            }
+
+            matchLen += MinMatch;
+            if ((maxLen - (out.size() - outStart)) < matchLen) {
+                return comms::ErrorStatus::ProtocolError;
+            }
+
+            auto from = out.size() - offset;
+            out.reserve(out.size() + matchLen);
+            for (std::size_t idx = 0U; idx < matchLen; ++idx) {
+                // Copying byte by byte, the match may overlap the output
+                out.push_back(out[from + idx]);
+            }
+        }
+
+        return comms::ErrorStatus::ProtocolError;
+    }
+
+private:
+    static const std::size_t MinMatch = 4U;
+    static const std::size_t LastLiterals = 5U;
+    static const std::size_t MatchFindLimit = 12U;
+    static const std::size_t MinCompressLength = MatchFindLimit + 1U;
+    static const std::size_t MaxOffset = 0xffff;
+    static const std::size_t HashTableSize = static_cast<std::size_t>(1U) << THashLog;
+    static const std::uint8_t TokenMask = 0xf;
+    static const std::size_t ExtraLengthByte = 0xff;
+
+    static std::uint32_t read32(const std::uint8_t* data)
+    {
+        return
+            static_cast<std::uint32_t>(data[0]) |
+            (static_cast<std::uint32_t>(data[1]) << 8) |
+            (static_cast<std::uint32_t>(data[2]) << 16) |
+            (static_cast<std::uint32_t>(data[3]) << 24);
+    }
+
+    static std::size_t hash(std::uint32_t seq)
+    {
+        return static_cast<std::size_t>((seq * 2654435761U) >> (32U - THashLog));
+    }
+
+    static bool readExtraLength(const std::uint8_t* data, std::size_t len, std::size_t& pos, std::size_t& value)
+    {
+        if (value != TokenMask) {
+            return true;
+        }
+
+        while (pos < len) {
+            auto byte = data[pos];
+            ++pos;
+            value += byte;
+            if (byte != ExtraLengthByte) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    template <typename TOutput>
+    static void writeExtraLength(std::size_t value, TOutput& out)
+    {
+        while (ExtraLengthByte <= value) {
+            out.push_back(static_cast<std::uint8_t>(ExtraLengthByte));
+            value -= ExtraLengthByte;
+        }
+        out.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    static std::uint8_t tokenNibble(std::size_t value)
+    {
+        return static_cast<std::uint8_t>(value < TokenMask ? value : TokenMask);
+    }
+
+    template <typename TOutput>
+    static void writeSequence(
+        const std::uint8_t* literals,
+        std::size_t litLen,
+        std::size_t offset,
+        std::size_t matchLen,
+        TOutput& out)
+    {
+        auto matchLenCode = matchLen - MinMatch;
+        out.push_back(static_cast<std::uint8_t>((tokenNibble(litLen) << 4) | tokenNibble(matchLenCode)));
+        if (TokenMask <= litLen) {
+            writeExtraLength(litLen - TokenMask, out);
+        }
+
+        out.insert(out.end(), literals, literals + litLen);
+        out.push_back(static_cast<std::uint8_t>(offset & 0xff));
+        out.push_back(static_cast<std::uint8_t>((offset >> 8) & 0xff));
+        if (TokenMask <= matchLenCode) {
+            writeExtraLength(matchLenCode - TokenMask, out);
+        }
+    }
+
+    template <typename TOutput>
+    static void writeLastLiterals(const std::uint8_t* literals, std::size_t litLen, TOutput& out)
+    {
+        out.push_back(static_cast<std::uint8_t>(tokenNibble(litLen) << 4));
+        if (TokenMask <= litLen) {
+            writeExtraLength(litLen - TokenMask, out);
+        }
+
+        out.insert(out.end(), literals, literals + litLen);
+    }
+};
+
+}  // namespace compression
+
+}  // namespace protocol
+
+}  // namespace comms
@@ -0,0 +1,92 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <tuple>
+#include "comms/options.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+
+template <typename... TOptions>
+class CompressionLayerOptionsParser;
+
+template <>
+class CompressionLayerOptionsParser<>
+{
+public:
+    static const bool HasExtendingClass = false;
+    static const bool HasMinLength = false;
+    static const std::size_t MinLength = 0U;
+    static const bool HasMaxLength = false;
+    static const std::size_t MaxLength = 0xffff;
+};
+
+template <typename T, typename... TOptions>
+class CompressionLayerOptionsParser<comms::option::def::ExtendingClass<T>, TOptions...> :
+        public CompressionLayerOptionsParser<TOptions...>
+{
+public:
+    static const bool HasExtendingClass = true;
+    using ExtendingClass = T;
+};
+
+template <std::size_t TLen, typename... TOptions>
+class CompressionLayerOptionsParser<comms::option::app::CompressionLayerMinLength<TLen>, TOptions...> :
+        public CompressionLayerOptionsParser<TOptions...>
+{
+public:
+    static const bool HasMinLength = true;
+    static const std::size_t MinLength = TLen;
+};
+
+template <std::size_t TLen, typename... TOptions>
+class CompressionLayerOptionsParser<comms::option::app::CompressionLayerMaxLength<TLen>, TOptions...> :
+        public CompressionLayerOptionsParser<TOptions...>
+{
+public:
+    static const bool HasMaxLength = true;
+    static const std::size_t MaxLength = TLen;
+};
+
+template <typename... TOptions>
+class CompressionLayerOptionsParser<
+    comms::option::app::EmptyOption,
+    TOptions...> : public CompressionLayerOptionsParser<TOptions...>
+{
+};
+
+template <typename... TBundledOptions, typename... TOptions>
+class CompressionLayerOptionsParser<
+    std::tuple<TBundledOptions...>,
+    TOptions...> : public CompressionLayerOptionsParser<TBundledOptions..., TOptions...>
+{
+};
+
+} // namespace details
+
+} // namespace protocol
+
+} // namespace comms
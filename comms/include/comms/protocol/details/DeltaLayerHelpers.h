@@ -0,0 +1,370 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+
+#include "comms/ErrorStatus.h"
+#include "comms/Assert.h"
+#include "comms/util/Tuple.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+template <typename TMsg>
+constexpr std::size_t deltaLayerBitmapLength()
+{
+    return (std::tuple_size<typename TMsg::AllFields>::value + 7U) / 8U;
+}
+
+template <typename TMsg>
+using DeltaLayerBitmap = std::array<std::uint8_t, deltaLayerBitmapLength<TMsg>()>;
+
+inline bool deltaLayerIsBitSet(const std::uint8_t* bitmap, std::size_t idx)
+{
+    return (bitmap[idx / 8U] & (1U << (idx % 8U))) != 0U;
+}
+
+inline void deltaLayerSetBit(std::uint8_t* bitmap, std::size_t idx)
+{
+    bitmap[idx / 8U] = static_cast<std::uint8_t>(bitmap[idx / 8U] | (1U << (idx % 8U)));
+}
+
+template <typename TMsg>
+struct DeltaLayerMsgState
+{
+    using Fields = typename TMsg::AllFields;
+
+    Fields fields_;
+    std::size_t count_ = 0U;
+    bool valid_ = false;
+
+    // Values before the update by the frame being processed, only the
+    // fields marked in savedFields_ are stored in prevFields_
+    Fields prevFields_;
+    DeltaLayerBitmap<TMsg> savedFields_;
+    std::size_t prevCount_ = 0U;
+    bool prevValid_ = false;
+    bool modified_ = false;
+
+    void modify()
+    {
+        if (modified_) {
+            return;
+        }
+
+        savedFields_.fill(0U);
+        prevCount_ = count_;
+        prevValid_ = valid_;
+        modified_ = true;
+    }
+
+    template <std::size_t TIdx, typename TField>
+    void updateField(const TField& field)
+    {
+        COMMS_ASSERT(modified_);
+        if (!deltaLayerIsBitSet(savedFields_.data(), TIdx)) {
+            std::get<TIdx>(prevFields_) = std::get<TIdx>(fields_);
+            deltaLayerSetBit(savedFields_.data(), TIdx);
+        }
+
+        std::get<TIdx>(fields_) = field;
+    }
+
+    void commit()
+    {
+        modified_ = false;
+    }
+
+    void rollback()
+    {
+        if (!modified_) {
+            return;
+        }
+
+        comms::util::tupleForEachWithTemplateParamIdx(fields_, FieldRestorer(*this));
+        count_ = prevCount_;
+        valid_ = prevValid_;
+        modified_ = false;
+    }
+
+private:
+    class FieldRestorer
+    {
+    public:
+        explicit FieldRestorer(DeltaLayerMsgState& state) : state_(state) {}
+
+        template <std::size_t TIdx, typename TField>
+        void operator()(TField& field) const
+        {
+            if (deltaLayerIsBitSet(state_.savedFields_.data(), TIdx)) {
+                field = std::get<TIdx>(state_.prevFields_);
+            }
+        }
+
+    private:
+        DeltaLayerMsgState& state_;
+    };
+};
+
+// Copies to the state only the fields marked in the bitmap or, when
+// no bitmap is provided, the fields that differ from the stored ones.
+template <typename TState>
+class DeltaLayerStateUpdater
+{
+public:
+    DeltaLayerStateUpdater(TState& state, const std::uint8_t* bitmap)
+      : state_(state),
+        bitmap_(bitmap)
+    {
+    }
+
+    template <std::size_t TIdx, typename TField>
+    void operator()(const TField& field) const
+    {
+        if (bitmap_ != nullptr) {
+            if (!deltaLayerIsBitSet(bitmap_, TIdx)) {
+                return;
+            }
+        }
+        else if (field == std::get<TIdx>(state_.fields_)) {
+            return;
+        }
+
+        state_.template updateField<TIdx>(field);
+    }
+
+private:
+    TState& state_;
+    const std::uint8_t* bitmap_;
+};
+
+class DeltaLayerStateCommitter
+{
+public:
+    template <typename TState>
+    void operator()(TState& state) const
+    {
+        state.commit();
+    }
+};
+
+class DeltaLayerStateRollback
+{
+public:
+    template <typename TState>
+    void operator()(TState& state) const
+    {
+        state.rollback();
+    }
+};
+
+template <typename TStates>
+class DeltaLayerStatesTxn
+{
+public:
+    template <std::size_t TIdx>
+    typename std::tuple_element<TIdx, TStates>::type& modify()
+    {
+        auto& state = std::get<TIdx>(states_);
+        state.modify();
+        modified_ = true;
+        return state;
+    }
+
+    template <std::size_t TIdx>
+    const typename std::tuple_element<TIdx, TStates>::type& get() const
+    {
+        return std::get<TIdx>(states_);
+    }
+
+    void begin()
+    {
+        ++depth_;
+    }
+
+    void end(bool success)
+    {
+        if (depth_ == 0U) {
+            return;
+        }
+
+        --depth_;
+        if ((depth_ != 0U) || (!modified_)) {
+            return;
+        }
+
+        if (success) {
+            comms::util::tupleForEach(states_, DeltaLayerStateCommitter());
+        }
+        else {
+            comms::util::tupleForEach(states_, DeltaLayerStateRollback());
+        }
+        modified_ = false;
+    }
+
+    void reset()
+    {
+        states_ = TStates();
+        modified_ = false;
+    }
+
+private:
+    TStates states_;
+    std::size_t depth_ = 0U;
+    bool modified_ = false;
+};
+
+template <typename TAllMessages>
+struct DeltaLayerStatesHelper;
+
+template <typename... TMessages>
+struct DeltaLayerStatesHelper<std::tuple<TMessages...> >
+{
+    using Type = std::tuple<DeltaLayerMsgState<TMessages>...>;
+};
+
+template <typename TAllMessages>
+using DeltaLayerStates = typename DeltaLayerStatesHelper<TAllMessages>::Type;
+
+template <typename TAllMessages>
+class DeltaLayerMsgIdxRetriever
+{
+public:
+    template <typename TMsg>
+    void handle()
+    {
+        idx_ = comms::util::TupleTypeIdx<TMsg, TAllMessages>::Value;
+    }
+
+    std::size_t getIdx() const
+    {
+        return idx_;
+    }
+
+private:
+    std::size_t idx_ = 0U;
+};
+
+template <typename TFields>
+class DeltaLayerBitmapCalc
+{
+public:
+    DeltaLayerBitmapCalc(const TFields& prevFields, std::uint8_t* bitmap, std::size_t& len)
+      : prevFields_(prevFields),
+        bitmap_(bitmap),
+        len_(len)
+    {
+    }
+
+    template <std::size_t TIdx, typename TField>
+    void operator()(const TField& field)
+    {
+        if (field == std::get<TIdx>(prevFields_)) {
+            return;
+        }
+
+        deltaLayerSetBit(bitmap_, TIdx);
+        len_ += field.length();
+    }
+
+private:
+    const TFields& prevFields_;
+    std::uint8_t* bitmap_;
+    std::size_t& len_;
+};
+
+template <typename TIter>
+class DeltaLayerFieldsWriter
+{
+public:
+    DeltaLayerFieldsWriter(const std::uint8_t* bitmap, TIter& iter, std::size_t size, comms::ErrorStatus& es)
+      : bitmap_(bitmap),
+        iter_(iter),
+        size_(size),
+        es_(es)
+    {
+    }
+
+    template <std::size_t TIdx, typename TField>
+    void operator()(const TField& field)
+    {
+        if ((es_ != comms::ErrorStatus::Success) || (!deltaLayerIsBitSet(bitmap_, TIdx))) {
+            return;
+        }
+
+        es_ = field.write(iter_, size_);
+        if (es_ == comms::ErrorStatus::Success) {
+            size_ -= field.length();
+        }
+    }
+
+private:
+    const std::uint8_t* bitmap_;
+    TIter& iter_;
+    std::size_t size_;
+    comms::ErrorStatus& es_;
+};
+
+template <typename TIter>
+class DeltaLayerFieldsReader
+{
+public:
+    DeltaLayerFieldsReader(const std::uint8_t* bitmap, TIter& iter, std::size_t size, comms::ErrorStatus& es)
+      : bitmap_(bitmap),
+        iter_(iter),
+        size_(size),
+        es_(es)
+    {
+    }
+
+    template <std::size_t TIdx, typename TField>
+    void operator()(TField& field)
+    {
+        if ((es_ != comms::ErrorStatus::Success) || (!deltaLayerIsBitSet(bitmap_, TIdx))) {
+            return;
+        }
+
+        es_ = field.read(iter_, size_);
+        if (es_ == comms::ErrorStatus::Success) {
+            size_ -= field.length();
+        }
+    }
+
+private:
+    const std::uint8_t* bitmap_;
+    TIter& iter_;
+    std::size_t size_;
+    comms::ErrorStatus& es_;
+};
+
+} // namespace details
+
+} // namespace protocol
+
+} // namespace comms
@@ -0,0 +1,82 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <tuple>
+#include "comms/options.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+
+template <typename... TOptions>
+class DeltaLayerOptionsParser;
+
+template <>
+class DeltaLayerOptionsParser<>
+{
+public:
+    static const bool HasExtendingClass = false;
+    static const bool HasKeyframeInterval = false;
+    static const std::size_t KeyframeInterval = 0U;
+};
+
+template <typename T, typename... TOptions>
+class DeltaLayerOptionsParser<comms::option::def::ExtendingClass<T>, TOptions...> :
+        public DeltaLayerOptionsParser<TOptions...>
+{
+public:
+    static const bool HasExtendingClass = true;
+    using ExtendingClass = T;
+};
+
+template <std::size_t TInterval, typename... TOptions>
+class DeltaLayerOptionsParser<comms::option::app::DeltaLayerKeyframeInterval<TInterval>, TOptions...> :
+        public DeltaLayerOptionsParser<TOptions...>
+{
+    static_assert(0U < TInterval, "Keyframe interval must be greater than 0");
+public:
+    static const bool HasKeyframeInterval = true;
+    static const std::size_t KeyframeInterval = TInterval;
+};
+
+template <typename... TOptions>
+class DeltaLayerOptionsParser<
+    comms::option::app::EmptyOption,
+    TOptions...> : public DeltaLayerOptionsParser<TOptions...>
+{
+};
+
+template <typename... TBundledOptions, typename... TOptions>
+class DeltaLayerOptionsParser<
+    std::tuple<TBundledOptions...>,
+    TOptions...> : public DeltaLayerOptionsParser<TBundledOptions..., TOptions...>
+{
+};
+
+} // namespace details
+
+} // namespace protocol
+
+} // namespace comms
@@ -0,0 +1,327 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "comms/ErrorStatus.h"
+#include "comms/details/InstrumentationHelper.h"
+#include "comms/protocol/ProtocolLayerBase.h"
+#include "comms/protocol/MsgDataLayer.h"
+#include "comms/protocol/MsgIdLayer.h"
+#include "comms/protocol/MsgSizeLayer.h"
+#include "comms/protocol/SyncPrefixLayer.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+template <typename T>
+struct FlatProtocolStackActualLayer
+{
+    using Type = T;
+};
+
+template <typename TField, typename TNextLayer, typename TDerived, typename... TOptions>
+struct FlatProtocolStackActualLayer<ProtocolLayerBase<TField, TNextLayer, TDerived, TOptions...> >
+{
+    using Type = TDerived;
+};
+
+template <typename TLayer>
+using FlatProtocolStackActualLayerT =
+    typename FlatProtocolStackActualLayer<
+        typename std::decay<
+            decltype(comms::protocol::toProtocolLayerBase(std::declval<TLayer&>()))
+        >::type
+    >::Type;
+
+template <typename TLayer>
+FlatProtocolStackActualLayerT<TLayer>& flatProtocolStackActualLayer(TLayer& layer)
+{
+    return static_cast<FlatProtocolStackActualLayerT<TLayer>&>(comms::protocol::toProtocolLayerBase(layer));
+}
+
+template <typename TField>
+constexpr bool flatProtocolStackIsFusableField()
+{
+    return (TField::minLength() == TField::maxLength()) && TField::hasReadNoStatus();
+}
+
+template <typename TLayer, bool TIsSizeLayer>
+struct FlatProtocolStackIsFusableSize
+{
+    static const bool Value = false;
+};
+
+template <typename TLayer>
+struct FlatProtocolStackIsFusableSize<TLayer, true>
+{
+    static const bool Value =
+        (!TLayer::ParsedOptions::HasExtendingClass) &&
+        flatProtocolStackIsFusableField<typename TLayer::Field>();
+};
+
+template <typename TLayer, bool TIsIdLayer>
+struct FlatProtocolStackIsFusableId
+{
+    static const bool Value = false;
+};
+
+template <typename TLayer>
+struct FlatProtocolStackIsFusableId<TLayer, true>
+{
+    static const bool Value =
+        (!TLayer::ParsedOptions::HasExtendingClass) &&
+        flatProtocolStackIsFusableField<typename TLayer::Field>();
+};
+
+struct FlatProtocolStackSyncTag {};
+struct FlatProtocolStackSizeTag {};
+struct FlatProtocolStackIdTag {};
+struct FlatProtocolStackOtherTag {};
+
+template <typename TLayer>
+using FlatProtocolStackTag =
+    typename std::conditional<
+        comms::protocol::isSyncPrefixLayer<TLayer>() &&
+            flatProtocolStackIsFusableField<typename TLayer::Field>(),
+        FlatProtocolStackSyncTag,
+        typename std::conditional<
+            FlatProtocolStackIsFusableSize<TLayer, comms::protocol::isMsgSizeLayer<TLayer>()>::Value,
+            FlatProtocolStackSizeTag,
+            typename std::conditional<
+                FlatProtocolStackIsFusableId<TLayer, comms::protocol::isMsgIdLayer<TLayer>()>::Value,
+                FlatProtocolStackIdTag,
+                FlatProtocolStackOtherTag
+            >::type
+        >::type
+    >::type;
+
+template <typename TLayer, typename TTag = FlatProtocolStackTag<TLayer> >
+struct FlatProtocolStackGroupLength;
+
+template <typename TLayer>
+struct FlatProtocolStackGroupLength<TLayer, FlatProtocolStackSyncTag>
+{
+    using NextLayer = FlatProtocolStackActualLayerT<typename TLayer::NextLayer>;
+    static const std::size_t Value =
+        TLayer::Field::maxLength() + FlatProtocolStackGroupLength<NextLayer>::Value;
+};
+
+template <typename TLayer>
+struct FlatProtocolStackGroupLength<TLayer, FlatProtocolStackSizeTag>
+{
+    static const std::size_t Value = TLayer::Field::maxLength();
+};
+
+template <typename TLayer>
+struct FlatProtocolStackGroupLength<TLayer, FlatProtocolStackIdTag>
+{
+    static const std::size_t Value = TLayer::Field::maxLength();
+};
+
+template <typename TLayer>
+struct FlatProtocolStackGroupLength<TLayer, FlatProtocolStackOtherTag>
+{
+    static const std::size_t Value = 0U;
+};
+
+class FlatProtocolStackHelper
+{
+public:
+    template <typename TLayer, typename TMsg, typename TIter, typename... TExtraValues>
+    static comms::ErrorStatus readFused(
+        TLayer& layer,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TExtraValues... extraValues)
+    {
+        using Tag = FlatProtocolStackTag<TLayer>;
+        if (size < FlatProtocolStackGroupLength<TLayer>::Value) {
+            // The group of fields following the size prefix is incomplete
+            return layer.read(msg, iter, size, extraValues...);
+        }
+
+        using InstrumentationTag =
+            typename std::conditional<
+                std::is_same<Tag, FlatProtocolStackOtherTag>::value,
+                comms::details::NotInstrumentedTag, // The read() of the layer is instrumented
+                comms::details::InstrumentationTag<TMsg>
+            >::type;
+        return readFusedInstrumented(layer, msg, iter, size, Tag(), InstrumentationTag(), extraValues...);
+    }
+
+private:
+    template <typename TLayer>
+    class FusedReader
+    {
+    public:
+        explicit FusedReader(TLayer& layer) : layer_(layer) {}
+
+        template <typename TMsg, typename TIter, typename... TExtraValues>
+        comms::ErrorStatus read(
+            TMsg& msg,
+            TIter& iter,
+            std::size_t size,
+            TExtraValues... extraValues)
+        {
+            return readFused(layer_, msg, iter, size, extraValues...);
+        }
+
+    private:
+        TLayer& layer_;
+    };
+
+    template <typename TLayer, typename TMsg, typename TIter, typename TTag, typename... TExtraValues>
+    static comms::ErrorStatus readFusedInstrumented(
+        TLayer& layer,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TTag,
+        comms::details::NotInstrumentedTag,
+        TExtraValues... extraValues)
+    {
+        return readFusedInternal(layer, msg, iter, size, TTag(), extraValues...);
+    }
+
+    template <typename TLayer, typename TMsg, typename TIter, typename TTag, typename... TExtraValues>
+    static comms::ErrorStatus readFusedInstrumented(
+        TLayer& layer,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TTag,
+        comms::details::InstrumentedTag,
+        TExtraValues... extraValues)
+    {
+        using Policy = comms::details::InstrumentationPolicyT<TMsg>;
+        auto start = Policy::template layerReadBegin<TLayer>();
+        auto fromIter = iter;
+        auto es = readFusedInternal(layer, msg, iter, size, TTag(), extraValues...);
+        Policy::template layerReadEnd<TLayer>(
+            start,
+            msg,
+            comms::details::InstrumentationHelper::distance(fromIter, iter),
+            es);
+        return es;
+    }
+
+    template <typename TLayer, typename TMsg, typename TIter, typename... TExtraValues>
+    static comms::ErrorStatus readFusedInternal(
+        TLayer& layer,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        FlatProtocolStackSyncTag,
+        TExtraValues... extraValues)
+    {
+        using Field = typename TLayer::Field;
+        COMMS_ASSERT(Field::maxLength() <= size);
+
+        Field field;
+        field.readNoStatus(iter);
+        if (field != Field()) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        return
+            readFused(
+                flatProtocolStackActualLayer(layer.nextLayer()),
+                msg,
+                iter,
+                size - Field::maxLength(),
+                extraValues...);
+    }
+
+    template <typename TLayer, typename TMsg, typename TIter, typename... TExtraValues>
+    static comms::ErrorStatus readFusedInternal(
+        TLayer& layer,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        FlatProtocolStackSizeTag,
+        TExtraValues... extraValues)
+    {
+        using Field = typename TLayer::Field;
+        COMMS_ASSERT(Field::maxLength() <= size);
+
+        Field field;
+        field.readNoStatus(iter);
+        using NextLayer = FlatProtocolStackActualLayerT<typename TLayer::NextLayer>;
+        return
+            layer.readAfterField(
+                field,
+                msg,
+                iter,
+                size - Field::maxLength(),
+                FusedReader<NextLayer>(flatProtocolStackActualLayer(layer.nextLayer())),
+                extraValues...);
+    }
+
+    template <typename TLayer, typename TMsg, typename TIter, typename... TExtraValues>
+    static comms::ErrorStatus readFusedInternal(
+        TLayer& layer,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        FlatProtocolStackIdTag,
+        TExtraValues... extraValues)
+    {
+        using Field = typename TLayer::Field;
+        COMMS_ASSERT(Field::maxLength() <= size);
+
+        Field field;
+        field.readNoStatus(iter);
+        return
+            layer.readAfterField(
+                field,
+                msg,
+                iter,
+                size - Field::maxLength(),
+                layer.createNextLayerReader(),
+                extraValues...);
+    }
+
+    template <typename TLayer, typename TMsg, typename TIter, typename... TExtraValues>
+    static comms::ErrorStatus readFusedInternal(
+        TLayer& layer,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        FlatProtocolStackOtherTag,
+        TExtraValues... extraValues)
+    {
+        return layer.read(msg, iter, size, extraValues...);
+    }
+};
+
+} // namespace details
+
+} // namespace protocol
+
+} // namespace comms
@@ -0,0 +1,100 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <utility>
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+template <typename TMsgPtr, typename TMsgIdType>
+class MsgBatchLayerMsgQueue
+{
+public:
+    MsgBatchLayerMsgQueue() = default;
+
+    // Pending messages are never shared
+    MsgBatchLayerMsgQueue(const MsgBatchLayerMsgQueue&) : elems_(), readIdx_(0U) {}
+    MsgBatchLayerMsgQueue(MsgBatchLayerMsgQueue&&) = default;
+
+    MsgBatchLayerMsgQueue& operator=(const MsgBatchLayerMsgQueue&)
+    {
+        return *this;
+    }
+
+    MsgBatchLayerMsgQueue& operator=(MsgBatchLayerMsgQueue&&) = default;
+
+    bool empty() const
+    {
+        return elems_.size() <= readIdx_;
+    }
+
+    std::size_t size() const
+    {
+        return elems_.size() - readIdx_;
+    }
+
+    void clear()
+    {
+        elems_.clear();
+        readIdx_ = 0U;
+    }
+
+    void push(TMsgPtr&& msg, TMsgIdType id, std::size_t idx)
+    {
+        elems_.push_back(Elem{std::move(msg), id, idx});
+    }
+
+    TMsgPtr pop(TMsgIdType& id, std::size_t& idx)
+    {
+        auto& elem = elems_[readIdx_];
+        ++readIdx_;
+        id = elem.id_;
+        idx = elem.idx_;
+        auto msg = std::move(elem.msg_);
+        if (empty()) {
+            clear();
+        }
+        return msg;
+    }
+
+private:
+    struct Elem
+    {
+        TMsgPtr msg_;
+        TMsgIdType id_;
+        std::size_t idx_;
+    };
+
+    std::vector<Elem> elems_;
+    std::size_t readIdx_ = 0U;
+};
+
+} // namespace details
+
+} // namespace protocol
+
+} // namespace comms
@@ -0,0 +1,105 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <tuple>
+#include "comms/options.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+
+template <typename... TOptions>
+class MsgBatchLayerOptionsParser;
+
+template <>
+class MsgBatchLayerOptionsParser<>
+{
+public:
+    static const bool HasExtendingClass = false;
+    static const bool HasFlushCount = false;
+    static const bool HasFlushBytes = false;
+    static const bool HasFlushTime = false;
+    static const std::size_t FlushCount = 0U;
+    static const std::size_t FlushBytes = 0U;
+    static const unsigned long long FlushTime = 0U;
+};
+
+template <typename T, typename... TOptions>
+class MsgBatchLayerOptionsParser<comms::option::def::ExtendingClass<T>, TOptions...> :
+        public MsgBatchLayerOptionsParser<TOptions...>
+{
+public:
+    static const bool HasExtendingClass = true;
+    using ExtendingClass = T;
+};
+
+template <std::size_t TCount, typename... TOptions>
+class MsgBatchLayerOptionsParser<comms::option::app::MsgBatchLayerFlushCount<TCount>, TOptions...> :
+        public MsgBatchLayerOptionsParser<TOptions...>
+{
+    static_assert(0U < TCount, "Flush count must be greater than 0");
+public:
+    static const bool HasFlushCount = true;
+    static const std::size_t FlushCount = TCount;
+};
+
+template <std::size_t TBytes, typename... TOptions>
+class MsgBatchLayerOptionsParser<comms::option::app::MsgBatchLayerFlushBytes<TBytes>, TOptions...> :
+        public MsgBatchLayerOptionsParser<TOptions...>
+{
+    static_assert(0U < TBytes, "Flush bytes must be greater than 0");
+public:
+    static const bool HasFlushBytes = true;
+    static const std::size_t FlushBytes = TBytes;
+};
+
+template <unsigned long long TMillisecs, typename... TOptions>
+class MsgBatchLayerOptionsParser<comms::option::app::MsgBatchLayerFlushTime<TMillisecs>, TOptions...> :
+        public MsgBatchLayerOptionsParser<TOptions...>
+{
+public:
+    static const bool HasFlushTime = true;
+    static const unsigned long long FlushTime = TMillisecs;
+};
+
+template <typename... TOptions>
+class MsgBatchLayerOptionsParser<
+    comms::option::app::EmptyOption,
+    TOptions...> : public MsgBatchLayerOptionsParser<TOptions...>
+{
+};
+
+template <typename... TBundledOptions, typename... TOptions>
+class MsgBatchLayerOptionsParser<
+    std::tuple<TBundledOptions...>,
+    TOptions...> : public MsgBatchLayerOptionsParser<TBundledOptions..., TOptions...>
+{
+};
+
+} // namespace details
+
+} // namespace protocol
+
+} // namespace comms
@@ -0,0 +1,153 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "comms/dispatch.h"
+#include "comms/util/Tuple.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+class MsgIdLayerNoMsgCache
+{
+};
+
+template <typename TAllMessages, typename TMsgPtr>
+class MsgIdLayerMsgCache
+{
+public:
+    MsgIdLayerMsgCache() = default;
+
+    // Cached objects are never shared
+    MsgIdLayerMsgCache(const MsgIdLayerMsgCache&) : slots_() {}
+    MsgIdLayerMsgCache(MsgIdLayerMsgCache&&) = default;
+
+    MsgIdLayerMsgCache& operator=(const MsgIdLayerMsgCache&)
+    {
+        return *this;
+    }
+
+    MsgIdLayerMsgCache& operator=(MsgIdLayerMsgCache&&) = default;
+
+    template <typename TId>
+    TMsgPtr take(TId&& id, unsigned idx)
+    {
+        TakeHandler handler(slots_);
+        comms::dispatchMsgType<TAllMessages>(std::forward<TId>(id), idx, handler);
+        return std::move(handler.msg_);
+    }
+
+    template <typename TId>
+    void put(TId&& id, unsigned idx, TMsgPtr&& msg)
+    {
+        PutHandler handler(slots_, std::move(msg));
+        comms::dispatchMsgType<TAllMessages>(std::forward<TId>(id), idx, handler);
+    }
+
+private:
+    using Slots = std::array<TMsgPtr, std::tuple_size<TAllMessages>::value>;
+
+    template <typename TMsg>
+    static constexpr std::size_t slotIdx()
+    {
+        return comms::util::TupleTypeIdx<TMsg, TAllMessages>::Value;
+    }
+
+    struct NoTransportFieldsTag {};
+    struct HasTransportFieldsTag {};
+
+    template <typename TMsg>
+    static void resetFields(TMsg& msg)
+    {
+        using Tag =
+            typename std::conditional<
+                TMsg::hasTransportFields(),
+                HasTransportFieldsTag,
+                NoTransportFieldsTag
+            >::type;
+
+        // The fields are restored to the state set by the constructor
+        // of the message, copy assignment reuses their storage capacity.
+        static const TMsg Default;
+        msg.fields() = Default.fields();
+        resetTransportFields(msg, Default, Tag());
+    }
+
+    template <typename TMsg>
+    static void resetTransportFields(TMsg& msg, const TMsg& defaultMsg, NoTransportFieldsTag)
+    {
+        static_cast<void>(msg);
+        static_cast<void>(defaultMsg);
+    }
+
+    template <typename TMsg>
+    static void resetTransportFields(TMsg& msg, const TMsg& defaultMsg, HasTransportFieldsTag)
+    {
+        msg.transportFields() = defaultMsg.transportFields();
+    }
+
+    struct TakeHandler
+    {
+        explicit TakeHandler(Slots& slots) : slots_(slots) {}
+
+        template <typename TMsg>
+        void handle()
+        {
+            msg_ = std::move(slots_[slotIdx<TMsg>()]);
+            if (msg_) {
+                resetFields(static_cast<TMsg&>(*msg_));
+            }
+        }
+
+        Slots& slots_;
+        TMsgPtr msg_;
+    };
+
+    struct PutHandler
+    {
+        PutHandler(Slots& slots, TMsgPtr&& msg) : slots_(slots), msg_(std::move(msg)) {}
+
+        template <typename TMsg>
+        void handle()
+        {
+            slots_[slotIdx<TMsg>()] = std::move(msg_);
+        }
+
+        Slots& slots_;
+        TMsgPtr msg_;
+    };
+
+    Slots slots_;
+};
+
+} // namespace details
+
+} // namespace protocol
+
+} // namespace comms
@@ -38,6 +38,7 @@ class MsgIdLayerOptionsParser<>
 {
 public:
     static const bool HasExtendingClass = false;
+    static const bool HasMsgRecycling = false;
     using FactoryOptions = std::tuple<>;
 };
 
@@ -50,6 +51,14 @@ public:
     using ExtendingClass = T;
 };
 
+template <typename... TOptions>
+class MsgIdLayerOptionsParser<comms::option::app::MsgRecycling, TOptions...> :
+        public MsgIdLayerOptionsParser<TOptions...>
+{
+public:
+    static const bool HasMsgRecycling = true;
+};
+
 template <typename... TOptions>
 class MsgIdLayerOptionsParser<
     comms::option::app::EmptyOption,
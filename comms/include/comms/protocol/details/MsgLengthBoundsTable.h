@@ -0,0 +1,246 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <limits>
+
+#include "comms/util/Tuple.h"
+#include "ProtocolLayerDetails.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+template <bool THasFieldsImpl>
+struct MsgLengthBoundsRetriever;
+
+template <>
+struct MsgLengthBoundsRetriever<true>
+{
+    template <typename TMsg>
+    static constexpr std::size_t minLength()
+    {
+        return TMsg::doMinLength();
+    }
+
+    template <typename TMsg>
+    static constexpr std::size_t maxLength()
+    {
+        return TMsg::doMaxLength();
+    }
+};
+
+template <>
+struct MsgLengthBoundsRetriever<false>
+{
+    template <typename TMsg>
+    static constexpr std::size_t minLength()
+    {
+        return 0U;
+    }
+
+    template <typename TMsg>
+    static constexpr std::size_t maxLength()
+    {
+        return std::numeric_limits<std::size_t>::max();
+    }
+};
+
+template <typename TMsg>
+constexpr std::size_t msgLengthBoundsMin()
+{
+    return MsgLengthBoundsRetriever<ProtocolLayerHasFieldsImpl<TMsg>::Value>::template minLength<TMsg>();
+}
+
+template <typename TMsg>
+constexpr std::size_t msgLengthBoundsMax()
+{
+    return MsgLengthBoundsRetriever<ProtocolLayerHasFieldsImpl<TMsg>::Value>::template maxLength<TMsg>();
+}
+
+template <typename... TMessages>
+struct MsgLengthBoundsAccumulator;
+
+template <>
+struct MsgLengthBoundsAccumulator<>
+{
+    static const std::size_t Min = std::numeric_limits<std::size_t>::max();
+    static const std::size_t Max = 0U;
+};
+
+template <typename TFirst, typename... TRest>
+struct MsgLengthBoundsAccumulator<TFirst, TRest...>
+{
+    static const std::size_t Min =
+        msgLengthBoundsMin<TFirst>() < MsgLengthBoundsAccumulator<TRest...>::Min ?
+            msgLengthBoundsMin<TFirst>() : MsgLengthBoundsAccumulator<TRest...>::Min;
+
+    static const std::size_t Max =
+        MsgLengthBoundsAccumulator<TRest...>::Max < msgLengthBoundsMax<TFirst>() ?
+            msgLengthBoundsMax<TFirst>() : MsgLengthBoundsAccumulator<TRest...>::Max;
+};
+
+template <typename TAllMessages>
+struct MsgLengthBoundsGlobal
+{
+    static const std::size_t Min = 0U;
+    static const std::size_t Max = std::numeric_limits<std::size_t>::max();
+};
+
+template <typename... TMessages>
+struct MsgLengthBoundsGlobal<std::tuple<TMessages...> >
+{
+    static const std::size_t Min = MsgLengthBoundsAccumulator<TMessages...>::Min;
+    static const std::size_t Max = MsgLengthBoundsAccumulator<TMessages...>::Max;
+};
+
+template <>
+struct MsgLengthBoundsGlobal<std::tuple<> > : public MsgLengthBoundsGlobal<void>
+{
+};
+
+struct MsgLengthBoundsFieldMinLengthRetriever
+{
+    template <typename TField>
+    constexpr std::size_t operator()(std::size_t size) const
+    {
+        return size + TField::minLength();
+    }
+};
+
+struct MsgLengthBoundsFieldMaxLengthRetriever
+{
+    template <typename TField>
+    constexpr std::size_t operator()(std::size_t size) const
+    {
+        return (std::numeric_limits<std::size_t>::max() - size) < TField::maxLength() ?
+            std::numeric_limits<std::size_t>::max() :
+            size + TField::maxLength();
+    }
+};
+
+template <typename TMsgIdType, typename TAllMessages>
+class MsgLengthBoundsTable;
+
+template <typename TMsgIdType>
+class MsgLengthBoundsTable<TMsgIdType, std::tuple<> >
+{
+public:
+    static constexpr std::size_t minLength()
+    {
+        return 0U;
+    }
+
+    static constexpr std::size_t maxLength()
+    {
+        return std::numeric_limits<std::size_t>::max();
+    }
+
+    template <typename TId>
+    static bool lookup(TId&& id, std::size_t& minLen, std::size_t& maxLen)
+    {
+        static_cast<void>(id);
+        static_cast<void>(minLen);
+        static_cast<void>(maxLen);
+        return false;
+    }
+};
+
+template <typename TMsgIdType, typename... TMessages>
+class MsgLengthBoundsTable<TMsgIdType, std::tuple<TMessages...> >
+{
+    using Accumulator = MsgLengthBoundsAccumulator<TMessages...>;
+public:
+    struct Entry
+    {
+        TMsgIdType m_id;
+        std::size_t m_minLen;
+        std::size_t m_maxLen;
+    };
+
+    static const std::size_t NumOfEntries = sizeof...(TMessages);
+
+    static constexpr std::size_t minLength()
+    {
+        return Accumulator::Min;
+    }
+
+    static constexpr std::size_t maxLength()
+    {
+        return Accumulator::Max;
+    }
+
+    template <typename TId>
+    static bool lookup(TId&& id, std::size_t& minLen, std::size_t& maxLen)
+    {
+        auto castedId = static_cast<TMsgIdType>(id);
+        std::size_t from = 0U;
+        std::size_t to = NumOfEntries;
+        while (from < to) {
+            auto mid = from + ((to - from) / 2);
+            if (Table[mid].m_id < castedId) {
+                from = mid + 1;
+                continue;
+            }
+            to = mid;
+        }
+
+        if ((NumOfEntries <= from) || (Table[from].m_id != castedId)) {
+            return false;
+        }
+
+        minLen = Table[from].m_minLen;
+        maxLen = Table[from].m_maxLen;
+        for (auto idx = from + 1; (idx < NumOfEntries) && (Table[idx].m_id == castedId); ++idx) {
+            if (Table[idx].m_minLen < minLen) {
+                minLen = Table[idx].m_minLen;
+            }
+
+            if (maxLen < Table[idx].m_maxLen) {
+                maxLen = Table[idx].m_maxLen;
+            }
+        }
+        return true;
+    }
+
+private:
+    static constexpr Entry Table[NumOfEntries] = {
+        {
+            static_cast<TMsgIdType>(TMessages::doGetId()),
+            msgLengthBoundsMin<TMessages>(),
+            msgLengthBoundsMax<TMessages>()
+        }...
+    };
+};
+
+template <typename TMsgIdType, typename... TMessages>
+constexpr typename MsgLengthBoundsTable<TMsgIdType, std::tuple<TMessages...> >::Entry
+MsgLengthBoundsTable<TMsgIdType, std::tuple<TMessages...> >::Table[NumOfEntries];
+
+} // namespace details
+
+} // namespace protocol
+
+} // namespace comms
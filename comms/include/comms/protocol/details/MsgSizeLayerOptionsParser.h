@@ -38,6 +38,7 @@ class MsgSizeLayerOptionsParser<>
 {
 public:
     static const bool HasExtendingClass = false;
+    static const bool HasVerifyLengthBounds = false;
 };
 
 template <typename T, typename... TOptions>
@@ -49,6 +50,14 @@ public:
     using ExtendingClass = T;
 };
 
+template <typename... TOptions>
+class MsgSizeLayerOptionsParser<comms::option::def::MsgSizeLayerVerifyLengthBounds, TOptions...> :
+        public MsgSizeLayerOptionsParser<TOptions...>
+{
+public:
+    static const bool HasVerifyLengthBounds = true;
+};
+
 template <typename... TOptions>
 class MsgSizeLayerOptionsParser<
     comms::option::app::EmptyOption,
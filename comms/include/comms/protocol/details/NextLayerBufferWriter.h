@@ -0,0 +1,134 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "comms/ErrorStatus.h"
+#include "comms/Message.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+template <bool THasWriteIterator>
+struct NextLayerBufferWriteIteratorHelper;
+
+template <>
+struct NextLayerBufferWriteIteratorHelper<true>
+{
+    template <typename TMsg>
+    using Type = typename TMsg::WriteIterator;
+};
+
+template <>
+struct NextLayerBufferWriteIteratorHelper<false>
+{
+    template <typename TMsg>
+    using Type = std::uint8_t*;
+};
+
+template <typename TMsg>
+using NextLayerBufferWriteIterator =
+    typename NextLayerBufferWriteIteratorHelper<TMsg::hasWrite()>::template Type<TMsg>;
+
+template <typename TIter>
+struct NextLayerBufferStorageHelper
+{
+    using Type = std::vector<std::uint8_t>;
+};
+
+template <typename TContainer>
+struct NextLayerBufferStorageHelper<std::back_insert_iterator<TContainer> >
+{
+    using Type = TContainer;
+};
+
+template <typename TIter>
+using NextLayerBufferStorage = typename NextLayerBufferStorageHelper<TIter>::Type;
+
+template <typename TIter>
+struct NextLayerBufferWriter
+{
+    template <typename TLayer, typename TMsg, typename TStorage>
+    static comms::ErrorStatus write(const TLayer& layer, const TMsg& msg, TStorage& storage)
+    {
+        static_assert(std::is_same<TIter, std::back_insert_iterator<TStorage> >::value,
+            "The write iterator of the message interface is expected to be either a pointer "
+            "or std::back_insert_iterator of the storage type");
+
+        auto offset = storage.size();
+        auto iter = std::back_inserter(storage);
+        auto es = layer.write(msg, iter, storage.max_size() - offset);
+        if (es == comms::ErrorStatus::UpdateRequired) {
+            auto updateIter = &storage[offset];
+            es = layer.update(updateIter, storage.size() - offset);
+        }
+
+        if (es != comms::ErrorStatus::Success) {
+            storage.resize(offset);
+        }
+        return es;
+    }
+};
+
+template <typename T>
+struct NextLayerBufferWriter<T*>
+{
+    template <typename TLayer, typename TMsg, typename TStorage>
+    static comms::ErrorStatus write(const TLayer& layer, const TMsg& msg, TStorage& storage)
+    {
+        static_assert(sizeof(T) == sizeof(typename TStorage::value_type),
+            "The element type of the write iterator must have the same size as the element of the storage");
+
+        auto offset = storage.size();
+        auto maxLen = layer.length(msg);
+        storage.resize(offset + maxLen);
+        auto* begPtr = reinterpret_cast<T*>(&storage[offset]);
+        auto iter = begPtr;
+        auto es = layer.write(msg, iter, maxLen);
+        auto len = static_cast<std::size_t>(std::distance(begPtr, iter));
+        if (es == comms::ErrorStatus::UpdateRequired) {
+            auto updateIter = begPtr;
+            es = layer.update(updateIter, len);
+        }
+
+        if (es != comms::ErrorStatus::Success) {
+            storage.resize(offset);
+            return es;
+        }
+
+        storage.resize(offset + len);
+        return es;
+    }
+};
+
+} // namespace details
+
+} // namespace protocol
+
+} // namespace comms
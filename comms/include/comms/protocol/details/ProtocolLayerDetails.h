@@ -17,6 +17,11 @@
 
 #pragma once
 
+#include <cstddef>
+#include <type_traits>
+
+#include "comms/ErrorStatus.h"
+
 namespace comms
 {
 
@@ -249,6 +254,140 @@ constexpr bool isMsgPayloadRetriever()
     return IsMsgPayloadRetrieverHelper<T>::Value;
 }
 
+template <typename TStats>
+class ReadStatisticsRetriever
+{
+public:
+    ReadStatisticsRetriever(TStats& stats) : stats_(stats) {}
+
+    TStats& stats() const
+    {
+        return stats_;
+    }
+
+private:
+    TStats& stats_;
+};
+
+template <typename T>
+struct IsReadStatisticsRetrieverHelper
+{
+    static const bool Value = false;
+};
+
+template <typename TStats>
+struct IsReadStatisticsRetrieverHelper<ReadStatisticsRetriever<TStats> >
+{
+    static const bool Value = true;
+};
+
+template <typename T>
+constexpr bool isReadStatisticsRetriever()
+{
+    return IsReadStatisticsRetrieverHelper<T>::Value;
+}
+
+class ReadStatisticsReporter
+{
+public:
+    template <typename TId, typename... TExtraValues>
+    static void frame(TId id, TExtraValues... extraValues)
+    {
+        apply(FrameOp<TId>(id), extraValues...);
+    }
+
+    template <typename... TExtraValues>
+    static void resyncBytes(std::size_t count, TExtraValues... extraValues)
+    {
+        apply(ResyncBytesOp(count), extraValues...);
+    }
+
+    template <typename... TExtraValues>
+    static void checksumFailure(TExtraValues... extraValues)
+    {
+        apply(ChecksumFailureOp(), extraValues...);
+    }
+
+    template <typename... TExtraValues>
+    static void status(comms::ErrorStatus es, TExtraValues... extraValues)
+    {
+        apply(StatusOp(es), extraValues...);
+    }
+
+private:
+    template <typename TId>
+    struct FrameOp
+    {
+        explicit FrameOp(TId id) : id_(id) {}
+
+        template <typename TStats>
+        void operator()(TStats& stats) const
+        {
+            stats.reportFrame(id_);
+        }
+
+        TId id_;
+    };
+
+    struct ResyncBytesOp
+    {
+        explicit ResyncBytesOp(std::size_t count) : count_(count) {}
+
+        template <typename TStats>
+        void operator()(TStats& stats) const
+        {
+            stats.reportResyncBytes(count_);
+        }
+
+        std::size_t count_;
+    };
+
+    struct ChecksumFailureOp
+    {
+        template <typename TStats>
+        void operator()(TStats& stats) const
+        {
+            stats.reportChecksumFailure();
+        }
+    };
+
+    struct StatusOp
+    {
+        explicit StatusOp(comms::ErrorStatus es) : es_(es) {}
+
+        template <typename TStats>
+        void operator()(TStats& stats) const
+        {
+            stats.reportReadStatus(es_);
+        }
+
+        comms::ErrorStatus es_;
+    };
+
+    template <typename TOp>
+    static void apply(const TOp& op)
+    {
+        static_cast<void>(op);
+    }
+
+    template <typename TOp, typename TStats, typename... TExtraValues>
+    static void apply(const TOp& op, ReadStatisticsRetriever<TStats> retriever, TExtraValues... extraValues)
+    {
+        op(retriever.stats());
+        apply(op, extraValues...);
+    }
+
+    template <typename TOp, typename T, typename... TExtraValues>
+    static void apply(const TOp& op, T retriever, TExtraValues... extraValues)
+    {
+        static_cast<void>(retriever);
+        static_assert(
+            !isReadStatisticsRetriever<typename std::decay<decltype(retriever)>::type>(),
+            "Mustn't be read statistics retriever");
+        apply(op, extraValues...);
+    }
+};
+
 } // namespace details
 
 } // namespace protocol
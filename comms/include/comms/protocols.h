@@ -23,10 +23,17 @@
 #include "protocol/MsgDataLayer.h"
 #include "protocol/MsgIdLayer.h"
 #include "protocol/MsgSizeLayer.h"
+#include "protocol/MsgBatchLayer.h"
 #include "protocol/SyncPrefixLayer.h"
 #include "protocol/ChecksumLayer.h"
 #include "protocol/ChecksumPrefixLayer.h"
 #include "protocol/TransportValueLayer.h"
+#include "protocol/CompressionLayer.h"
+#include "protocol/DeltaLayer.h"
+#include "protocol/FlatProtocolStack.h"
+#include "protocol/ReadStatistics.h"
 
 #include "protocol/checksum/BasicSum.h"
 #include "protocol/checksum/Crc.h"
+
+#include "protocol/compression/Lz77.h"
@@ -0,0 +1,230 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of @ref comms::util::RdtscInstrumentation
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "comms/ErrorStatus.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define COMMS_RDTSC_INSTRUMENTATION_HAS_RDTSC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define COMMS_RDTSC_INSTRUMENTATION_HAS_RDTSC
+#else
+#include <chrono>
+#endif
+
+namespace comms
+{
+
+namespace util
+{
+
+/// @brief Ready-made instrumentation policy measuring CPU cycles.
+/// @details Intended to be used with @ref comms::option::app::Instrumentation
+///     option of the message interface class:
+///     @code
+///     using MyMessage =
+///         comms::Message<
+///             ...,
+///             comms::option::app::Instrumentation<comms::util::RdtscInstrumentation<> >
+///         >;
+///     @endcode
+///     Uses @b rdtsc instruction on x86 platforms and falls back to
+///     the nanoseconds of @b std::chrono::steady_clock on other ones.
+///     The statistics are accumulated separately per every protocol layer type and
+///     every message type, and can be retrieved using the
+///     @ref layerReadStats(), @ref layerWriteStats(), @ref msgCreateStats() and
+///     @ref msgReadStats() functions. The measured cycles of the
+///     layer include the cycles of all the inner layers.
+/// @note The statistics are kept in the static storage and updated using
+///     relaxed atomic operations, i.e. the protocol stacks may be used in
+///     different threads. Use different @b TTag types to separate statistics
+///     of independent protocol stacks.
+/// @tparam TTag Any type used to separate statistics of independent instances.
+/// @headerfile comms/util/RdtscInstrumentation.h
+template <typename TTag = void>
+class RdtscInstrumentation
+{
+public:
+    /// @brief Type of the timestamp.
+    using Stamp = std::uint64_t;
+
+    /// @brief Accumulated statistics of a single operation
+    struct Stats
+    {
+        std::uint64_t count = 0U; ///< Number of performed operations
+        std::uint64_t cycles = 0U; ///< Total number of measured cycles
+        std::uint64_t bytes = 0U; ///< Total number of bytes consumed or produced
+        std::uint64_t failures = 0U; ///< Number of unsuccessful operations
+    };
+
+    /// @brief Get current timestamp.
+    static Stamp now()
+    {
+#ifdef COMMS_RDTSC_INSTRUMENTATION_HAS_RDTSC
+        return static_cast<Stamp>(__rdtsc());
+#else
+        return
+            static_cast<Stamp>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    /// @brief Statistics of the read operation of the protocol layer.
+    template <typename TLayer>
+    static Stats layerReadStats()
+    {
+        return snapshot(stats<LayerReadKind, TLayer>());
+    }
+
+    /// @brief Statistics of the write operation of the protocol layer.
+    template <typename TLayer>
+    static Stats layerWriteStats()
+    {
+        return snapshot(stats<LayerWriteKind, TLayer>());
+    }
+
+    /// @brief Statistics of the message objects creation by the @ref comms::protocol::MsgIdLayer.
+    template <typename TLayer>
+    static Stats msgCreateStats()
+    {
+        return snapshot(stats<MsgCreateKind, TLayer>());
+    }
+
+    /// @brief Statistics of the message fields read.
+    template <typename TMsg>
+    static Stats msgReadStats()
+    {
+        return snapshot(stats<MsgReadKind, TMsg>());
+    }
+
+    /// @cond SKIP_DOC
+    template <typename TLayer>
+    static Stamp layerReadBegin()
+    {
+        return now();
+    }
+
+    template <typename TLayer, typename TMsg>
+    static void layerReadEnd(Stamp start, const TMsg&, std::size_t consumed, comms::ErrorStatus es)
+    {
+        update(stats<LayerReadKind, TLayer>(), start, consumed, es == comms::ErrorStatus::Success);
+    }
+
+    template <typename TLayer>
+    static Stamp layerWriteBegin()
+    {
+        return now();
+    }
+
+    template <typename TLayer, typename TMsg>
+    static void layerWriteEnd(Stamp start, const TMsg&, std::size_t written, comms::ErrorStatus es)
+    {
+        update(stats<LayerWriteKind, TLayer>(), start, written, es == comms::ErrorStatus::Success);
+    }
+
+    template <typename TLayer, typename TId>
+    static Stamp msgCreateBegin(const TId&)
+    {
+        return now();
+    }
+
+    template <typename TLayer, typename TId>
+    static void msgCreateEnd(Stamp start, const TId&, bool created)
+    {
+        update(stats<MsgCreateKind, TLayer>(), start, 0U, created);
+    }
+
+    template <typename TMsg>
+    static Stamp msgReadBegin()
+    {
+        return now();
+    }
+
+    template <typename TMsg>
+    static void msgReadEnd(Stamp start, const TMsg&, std::size_t consumed, comms::ErrorStatus es)
+    {
+        update(stats<MsgReadKind, TMsg>(), start, consumed, es == comms::ErrorStatus::Success);
+    }
+    /// @endcond
+
+private:
+    struct LayerReadKind {};
+    struct LayerWriteKind {};
+    struct MsgCreateKind {};
+    struct MsgReadKind {};
+
+    using Counter = std::atomic<std::uint64_t>;
+
+    struct Counters
+    {
+        Counter count;
+        Counter cycles;
+        Counter bytes;
+        Counter failures;
+    };
+
+    template <typename TKind, typename T>
+    static Counters& stats()
+    {
+        // Zero initialised as static storage
+        static Counters Obj;
+        return Obj;
+    }
+
+    static void increment(Counter& counter, std::uint64_t val)
+    {
+        counter.fetch_add(val, std::memory_order_relaxed);
+    }
+
+    static Stats snapshot(const Counters& c)
+    {
+        Stats s;
+        s.count = c.count.load(std::memory_order_relaxed);
+        s.cycles = c.cycles.load(std::memory_order_relaxed);
+        s.bytes = c.bytes.load(std::memory_order_relaxed);
+        s.failures = c.failures.load(std::memory_order_relaxed);
+        return s;
+    }
+
+    static void update(Counters& c, Stamp start, std::size_t bytes, bool success)
+    {
+        auto end = now();
+        increment(c.count, 1U);
+        increment(c.cycles, end - start);
+        increment(c.bytes, bytes);
+        if (!success) {
+            increment(c.failures, 1U);
+        }
+    }
+};
+
+} // namespace util
+
+} // namespace comms
+
+#undef COMMS_RDTSC_INSTRUMENTATION_HAS_RDTSC
@@ -0,0 +1,989 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of @ref comms::util::SmallString
+
+#pragma once
+
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <initializer_list>
+
+#include "comms/Assert.h"
+#include "SmallVector.h"
+
+namespace comms
+{
+
+namespace util
+{
+
+/// @brief Replacement to <a href="http://en.cppreference.com/w/cpp/string/basic_string">std::string</a>
+///     with small buffer optimisation.
+/// @details Uses @ref comms::util::SmallVector to store the zero-terminated string,
+///     i.e. strings of up to @b TSize characters do not require any dynamic
+///     memory allocation, while longer ones are moved to the heap. Provides
+///     almost the same interface as
+///     <a href="http://en.cppreference.com/w/cpp/string/basic_string">std::string</a>.
+/// @tparam TSize Maximum length of the string (not including zero termination character)
+///     that doesn't require dynamic memory allocation.
+/// @tparam Type of the single character.
+/// @headerfile "comms/util/SmallString.h"
+template <std::size_t TSize, typename TChar = char>
+class SmallString
+{
+    using StorageType = SmallVector<TChar, TSize + 1>;
+    using Traits = std::char_traits<TChar>;
+
+    template <std::size_t TOtherSize, typename TOtherChar>
+    friend class SmallString;
+
+public:
+    /// @brief Type of single character.
+    using value_type = TChar;
+    /// @brief Type used for size information
+    using size_type = std::size_t;
+    /// @brief Type used in pointer arithmetics
+    using difference_type = typename StorageType::difference_type;
+    /// @brief Reference to single character
+    using reference = value_type&;
+    /// @brief Const reference to single character
+    using const_reference = const value_type&;
+    /// @brief Pointer to single character
+    using pointer = value_type*;
+    /// @brief Const pointer to single character
+    using const_pointer = const value_type*;
+    /// @brief Type of the iterator.
+    using iterator = pointer;
+    /// @brief Type of the const iterator
+    using const_iterator = const_pointer;
+    /// @brief Type of the reverse iterator
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    /// @brief Type of the const reverse iterator
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /// @brief Same as std::string::npos.
+    static const size_type npos = static_cast<size_type>(-1);
+
+    /// @brief Default constructor
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/basic_string">Reference</a>
+    SmallString()
+    {
+        endString();
+    }
+
+    /// @brief Constructor variant
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/basic_string">Reference</a>
+    SmallString(size_type count, value_type ch)
+    {
+        assign(count, ch);
+    }
+
+    /// @brief Constructor variant.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/basic_string">Reference</a>
+    template <std::size_t TOtherSize>
+    SmallString(
+        const SmallString<TOtherSize, TChar>& other,
+        size_type pos,
+        size_type count = npos)
+    {
+        assign(other, pos, count);
+    }
+
+    /// @brief Constructor variant.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/basic_string">Reference</a>
+    SmallString(const_pointer str, size_type count)
+    {
+        assign(str, count);
+    }
+
+    /// @brief Constructor variant.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/basic_string">Reference</a>
+    SmallString(const_pointer str)
+    {
+        assign(str);
+    }
+
+    /// @brief Constructor variant.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/basic_string">Reference</a>
+    template <typename TIter>
+    SmallString(TIter first, TIter last)
+    {
+        assign(first, last);
+    }
+
+    /// @brief Copy constructor.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/basic_string">Reference</a>
+    SmallString(const SmallString&) = default;
+
+    /// @brief Copy constructor variant.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/basic_string">Reference</a>
+    template <std::size_t TOtherSize>
+    explicit SmallString(const SmallString<TOtherSize, TChar>& other)
+    {
+        assign(other);
+    }
+
+    /// @brief Move constructor.
+    /// @details Takes ownership of the dynamically allocated buffer (if such
+    ///     is used by the other string).
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/basic_string">Reference</a>
+    SmallString(SmallString&& other) noexcept
+      : vec_(std::move(other.vec_))
+    {
+        other.endString();
+    }
+
+    /// @brief Constructor variant.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/basic_string">Reference</a>
+    SmallString(std::initializer_list<value_type> init)
+    {
+        assign(init.begin(), init.end());
+    }
+
+    /// @brief Destructor
+    ~SmallString() noexcept = default;
+
+    /// @brief Copy assignment
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator%3D">Reference</a>
+    SmallString& operator=(const SmallString&) = default;
+
+    /// @brief Copy assignment from string of different capacity.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator%3D">Reference</a>
+    template <std::size_t TOtherSize>
+    SmallString& operator=(const SmallString<TOtherSize, TChar>& other)
+    {
+        return assign(other);
+    }
+
+    /// @brief Move assignment
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator%3D">Reference</a>
+    SmallString& operator=(SmallString&& other) noexcept
+    {
+        if (&other != this) {
+            vec_ = std::move(other.vec_);
+            other.endString();
+        }
+        return *this;
+    }
+
+    /// @brief Assignment operator
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator%3D">Reference</a>
+    SmallString& operator=(const_pointer str)
+    {
+        return assign(str);
+    }
+
+    /// @brief Assignment operator
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator%3D">Reference</a>
+    SmallString& operator=(value_type ch)
+    {
+        return assign(1, ch);
+    }
+
+    /// @brief Assignment operator
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator%3D">Reference</a>
+    SmallString& operator=(std::initializer_list<value_type> init)
+    {
+        return assign(init);
+    }
+
+    /// @brief Assign characters to a string
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/assign">Reference</a>
+    SmallString& assign(size_type count, value_type ch)
+    {
+        vec_.assign(count, ch);
+        endString();
+        return *this;
+    }
+
+    /// @brief Assign characters to a string
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/assign">Reference</a>
+    template <std::size_t TOtherSize>
+    SmallString& assign(const SmallString<TOtherSize, TChar>& other)
+    {
+        return assign(other.data(), other.size());
+    }
+
+    /// @brief Assign characters to a string
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/assign">Reference</a>
+    template <std::size_t TOtherSize>
+    SmallString& assign(
+        const SmallString<TOtherSize, TChar>& other,
+        size_type pos,
+        size_type count = npos)
+    {
+        COMMS_ASSERT(pos <= other.size());
+        return assign(other.data() + pos, std::min(count, other.size() - pos));
+    }
+
+    /// @brief Assign characters to a string
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/assign">Reference</a>
+    SmallString& assign(const_pointer str, size_type count)
+    {
+        vec_.assign(str, str + count);
+        endString();
+        return *this;
+    }
+
+    /// @brief Assign characters to a string
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/assign">Reference</a>
+    SmallString& assign(const_pointer str)
+    {
+        return assign(str, Traits::length(str));
+    }
+
+    /// @brief Assign characters to a string
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/assign">Reference</a>
+    template <typename TIter>
+    SmallString& assign(TIter first, TIter last)
+    {
+        vec_.assign(first, last);
+        endString();
+        return *this;
+    }
+
+    /// @brief Assign characters to a string
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/assign">Reference</a>
+    SmallString& assign(std::initializer_list<value_type> init)
+    {
+        return assign(init.begin(), init.end());
+    }
+
+    /// @brief Access specified character with bounds checking.
+    /// @details The bounds check is performed with COMMS_ASSERT() macro, which means
+    ///     it is performed only in DEBUG mode compilation. In case NDEBUG
+    ///     symbol is defined (RELEASE mode compilation), this call is equivalent
+    ///     to operator[]().
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/at">Reference</a>
+    reference at(size_type pos)
+    {
+        COMMS_ASSERT(pos < size());
+        return vec_[pos];
+    }
+
+    /// @brief Access specified character with bounds checking.
+    /// @details The bounds check is performed with COMMS_ASSERT() macro, which means
+    ///     it is performed only in DEBUG mode compilation. In case NDEBUG
+    ///     symbol is defined (RELEASE mode compilation), this call is equivalent
+    ///     to operator[]().
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/at">Reference</a>
+    const_reference at(size_type pos) const
+    {
+        COMMS_ASSERT(pos < size());
+        return vec_[pos];
+    }
+
+    /// @brief Access specified character without bounds checking.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_at">Reference</a>
+    reference operator[](size_type pos)
+    {
+        return vec_[pos];
+    }
+
+    /// @brief Access specified character without bounds checking.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_at">Reference</a>
+    const_reference operator[](size_type pos) const
+    {
+        return vec_[pos];
+    }
+
+    /// @brief Accesses the first character.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/front">Reference</a>
+    /// @pre The string is not empty.
+    reference front()
+    {
+        COMMS_ASSERT(!empty());
+        return vec_.front();
+    }
+
+    /// @brief Accesses the first character.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/front">Reference</a>
+    /// @pre The string is not empty.
+    const_reference front() const
+    {
+        COMMS_ASSERT(!empty());
+        return vec_.front();
+    }
+
+    /// @brief Accesses the last character.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/back">Reference</a>
+    /// @pre The string is not empty.
+    reference back()
+    {
+        COMMS_ASSERT(!empty());
+        return vec_[size() - 1];
+    }
+
+    /// @brief Accesses the last character.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/back">Reference</a>
+    /// @pre The string is not empty.
+    const_reference back() const
+    {
+        COMMS_ASSERT(!empty());
+        return vec_[size() - 1];
+    }
+
+    /// @brief Returns a pointer to the first character of a string.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/data">Reference</a>
+    const_pointer data() const
+    {
+        return vec_.data();
+    }
+
+    /// @brief Returns a non-modifiable standard C character array version of the string.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/c_str">Reference</a>
+    const_pointer c_str() const
+    {
+        return data();
+    }
+
+    /// @brief Returns an iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/begin">Reference</a>
+    iterator begin()
+    {
+        return vec_.begin();
+    }
+
+    /// @brief Returns an iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/begin">Reference</a>
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    /// @brief Returns an iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/begin">Reference</a>
+    const_iterator cbegin() const
+    {
+        return vec_.cbegin();
+    }
+
+    /// @brief Returns an iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/end">Reference</a>
+    iterator end()
+    {
+        return begin() + size();
+    }
+
+    /// @brief Returns an iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/end">Reference</a>
+    const_iterator end() const
+    {
+        return cend();
+    }
+
+    /// @brief Returns an iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/end">Reference</a>
+    const_iterator cend() const
+    {
+        return cbegin() + size();
+    }
+
+    /// @brief Returns a reverse iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/rbegin">Reference</a>
+    reverse_iterator rbegin()
+    {
+        return reverse_iterator(end());
+    }
+
+    /// @brief Returns a reverse iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/rbegin">Reference</a>
+    const_reverse_iterator rbegin() const
+    {
+        return crbegin();
+    }
+
+    /// @brief Returns a reverse iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/rbegin">Reference</a>
+    const_reverse_iterator crbegin() const
+    {
+        return const_reverse_iterator(cend());
+    }
+
+    /// @brief Returns a reverse iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/rend">Reference</a>
+    reverse_iterator rend()
+    {
+        return reverse_iterator(begin());
+    }
+
+    /// @brief Returns a reverse iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/rend">Reference</a>
+    const_reverse_iterator rend() const
+    {
+        return crend();
+    }
+
+    /// @brief Returns a reverse iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/rend">Reference</a>
+    const_reverse_iterator crend() const
+    {
+        return const_reverse_iterator(cbegin());
+    }
+
+    /// @brief Checks whether the string is empty.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/empty">Reference</a>
+    bool empty() const
+    {
+        return size() == 0U;
+    }
+
+    /// @brief returns the number of characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/size">Reference</a>
+    size_type size() const
+    {
+        COMMS_ASSERT(!vec_.empty());
+        return vec_.size() - 1;
+    }
+
+    /// @brief returns the number of characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/size">Reference</a>
+    size_type length() const
+    {
+        return size();
+    }
+
+    /// @brief Returns the maximum number of characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/max_size">Reference</a>
+    size_type max_size() const
+    {
+        return vec_.max_size() - 1;
+    }
+
+    /// @brief Reserves storage.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/reserve">Reference</a>
+    void reserve(size_type new_cap)
+    {
+        vec_.reserve(new_cap + 1);
+    }
+
+    /// @brief returns the number of characters that can be held in currently allocated storage.
+    /// @details Never less than @b TSize.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/capacity">Reference</a>
+    size_type capacity() const
+    {
+        return vec_.capacity() - 1;
+    }
+
+    /// @brief Reduces memory usage by freeing unused memory.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/shrink_to_fit">Reference</a>
+    void shrink_to_fit()
+    {
+        vec_.shrink_to_fit();
+    }
+
+    /// @brief Clears the contents.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/clear">Reference</a>
+    void clear()
+    {
+        vec_.clear();
+        endString();
+    }
+
+    /// @brief Inserts characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/insert">Reference</a>
+    SmallString& insert(size_type idx, size_type count, value_type ch)
+    {
+        COMMS_ASSERT(idx <= size());
+        vec_.insert(vec_.cbegin() + idx, count, ch);
+        return *this;
+    }
+
+    /// @brief Inserts characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/insert">Reference</a>
+    SmallString& insert(size_type idx, const_pointer str)
+    {
+        return insert(idx, str, Traits::length(str));
+    }
+
+    /// @brief Inserts characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/insert">Reference</a>
+    SmallString& insert(size_type idx, const_pointer str, size_type count)
+    {
+        COMMS_ASSERT(idx <= size());
+        vec_.insert(vec_.cbegin() + idx, str, str + count);
+        return *this;
+    }
+
+    /// @brief Inserts characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/insert">Reference</a>
+    template <std::size_t TAnySize>
+    SmallString& insert(size_type idx, const SmallString<TAnySize, TChar>& str)
+    {
+        return insert(idx, str.data(), str.size());
+    }
+
+    /// @brief Inserts characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/insert">Reference</a>
+    iterator insert(const_iterator pos, value_type ch)
+    {
+        return vec_.insert(pos, ch);
+    }
+
+    /// @brief Inserts characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/insert">Reference</a>
+    iterator insert(const_iterator pos, size_type count, value_type ch)
+    {
+        return vec_.insert(pos, count, ch);
+    }
+
+    /// @brief Inserts characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/insert">Reference</a>
+    template <typename TIter>
+    iterator insert(const_iterator pos, TIter first, TIter last)
+    {
+        return vec_.insert(pos, first, last);
+    }
+
+    /// @brief Inserts characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/insert">Reference</a>
+    iterator insert(const_iterator pos, std::initializer_list<value_type> init)
+    {
+        return insert(pos, init.begin(), init.end());
+    }
+
+    /// @brief Removes characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/erase">Reference</a>
+    SmallString& erase(size_type idx, size_type count = npos)
+    {
+        COMMS_ASSERT(idx <= size());
+        auto from = cbegin() + idx;
+        erase(from, from + std::min(count, size() - idx));
+        return *this;
+    }
+
+    /// @brief Removes characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/erase">Reference</a>
+    iterator erase(const_iterator pos)
+    {
+        return erase(pos, pos + 1);
+    }
+
+    /// @brief Removes characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/erase">Reference</a>
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        COMMS_ASSERT(last <= cend());
+        return vec_.erase(first, last);
+    }
+
+    /// @brief Appends a character to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/push_back">Reference</a>
+    void push_back(value_type ch)
+    {
+        vec_.back() = ch;
+        endString();
+    }
+
+    /// @brief Removes the last character.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/pop_back">Reference</a>
+    void pop_back()
+    {
+        COMMS_ASSERT(!empty());
+        vec_.pop_back();
+        vec_.back() = TChar();
+    }
+
+    /// @brief Appends characters to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/append">Reference</a>
+    SmallString& append(size_type count, value_type ch)
+    {
+        return insert(size(), count, ch);
+    }
+
+    /// @brief Appends characters to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/append">Reference</a>
+    template <std::size_t TAnySize>
+    SmallString& append(const SmallString<TAnySize, TChar>& other)
+    {
+        return append(other.data(), other.size());
+    }
+
+    /// @brief Appends characters to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/append">Reference</a>
+    SmallString& append(const_pointer str, size_type count)
+    {
+        return insert(size(), str, count);
+    }
+
+    /// @brief Appends characters to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/append">Reference</a>
+    SmallString& append(const_pointer str)
+    {
+        return insert(size(), str);
+    }
+
+    /// @brief Appends characters to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/append">Reference</a>
+    template <typename TIter>
+    SmallString& append(TIter first, TIter last)
+    {
+        insert(cend(), first, last);
+        return *this;
+    }
+
+    /// @brief Appends characters to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/append">Reference</a>
+    SmallString& append(std::initializer_list<value_type> init)
+    {
+        return append(init.begin(), init.end());
+    }
+
+    /// @brief Appends characters to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator%2B%3D">Reference</a>
+    template <std::size_t TAnySize>
+    SmallString& operator+=(const SmallString<TAnySize, TChar>& other)
+    {
+        return append(other);
+    }
+
+    /// @brief Appends characters to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator%2B%3D">Reference</a>
+    SmallString& operator+=(value_type ch)
+    {
+        push_back(ch);
+        return *this;
+    }
+
+    /// @brief Appends characters to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator%2B%3D">Reference</a>
+    SmallString& operator+=(const_pointer str)
+    {
+        return append(str);
+    }
+
+    /// @brief Appends characters to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator%2B%3D">Reference</a>
+    SmallString& operator+=(std::initializer_list<value_type> init)
+    {
+        return append(init);
+    }
+
+    /// @brief Compares two strings.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/compare">Reference</a>
+    template <std::size_t TAnySize>
+    int compare(const SmallString<TAnySize, TChar>& other) const
+    {
+        return compare(0, size(), other.data(), other.size());
+    }
+
+    /// @brief Compares two strings.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/compare">Reference</a>
+    int compare(const_pointer str) const
+    {
+        return compare(0, size(), str, Traits::length(str));
+    }
+
+    /// @brief Compares two strings.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/compare">Reference</a>
+    int compare(size_type pos, size_type count, const_pointer str) const
+    {
+        return compare(pos, count, str, Traits::length(str));
+    }
+
+    /// @brief Compares two strings.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/compare">Reference</a>
+    int compare(size_type pos, size_type count1, const_pointer str, size_type count2) const
+    {
+        COMMS_ASSERT(pos <= size());
+        count1 = std::min(count1, size() - pos);
+        auto result = Traits::compare(data() + pos, str, std::min(count1, count2));
+        if (result != 0) {
+            return result;
+        }
+
+        if (count1 < count2) {
+            return -1;
+        }
+
+        if (count2 < count1) {
+            return 1;
+        }
+
+        return 0;
+    }
+
+    /// @brief Returns a substring
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/substr">Reference</a>
+    SmallString substr(size_type pos = 0, size_type count = npos) const
+    {
+        COMMS_ASSERT(pos <= size());
+        return SmallString(data() + pos, std::min(count, size() - pos));
+    }
+
+    /// @brief Copies characters
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/copy">Reference</a>
+    size_type copy(pointer dest, size_type count, size_type pos = 0) const
+    {
+        COMMS_ASSERT(pos <= size());
+        count = std::min(count, size() - pos);
+        std::copy_n(cbegin() + pos, count, dest);
+        return count;
+    }
+
+    /// @brief Changes the number of characters stored.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/resize">Reference</a>
+    void resize(size_type count)
+    {
+        resize(count, TChar());
+    }
+
+    /// @brief Changes the number of characters stored.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/resize">Reference</a>
+    void resize(size_type count, value_type ch)
+    {
+        vec_.back() = ch;
+        vec_.resize(count + 1, ch);
+        vec_.back() = TChar();
+    }
+
+    /// @brief Swaps the contents of two strings.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/swap">Reference</a>
+    void swap(SmallString& other)
+    {
+        vec_.swap(other.vec_);
+    }
+
+    /// @brief Find characters in the string.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/find">Reference</a>
+    template <std::size_t TAnySize>
+    size_type find(const SmallString<TAnySize, TChar>& str, size_type pos = 0) const
+    {
+        return find(str.data(), pos, str.size());
+    }
+
+    /// @brief Find characters in the string.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/find">Reference</a>
+    size_type find(const_pointer str, size_type pos, size_type count) const
+    {
+        if (size() < pos) {
+            return npos;
+        }
+
+        auto iter = std::search(cbegin() + pos, cend(), str, str + count);
+        if ((iter == cend()) && (0U < count)) {
+            return npos;
+        }
+
+        return static_cast<size_type>(std::distance(cbegin(), iter));
+    }
+
+    /// @brief Find characters in the string.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/find">Reference</a>
+    size_type find(const_pointer str, size_type pos = 0) const
+    {
+        return find(str, pos, Traits::length(str));
+    }
+
+    /// @brief Find character in the string.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/find">Reference</a>
+    size_type find(value_type ch, size_type pos = 0) const
+    {
+        return find(&ch, pos, 1U);
+    }
+
+    /// @brief Find the last occurrence of the character.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/rfind">Reference</a>
+    size_type rfind(value_type ch, size_type pos = npos) const
+    {
+        if (empty()) {
+            return npos;
+        }
+
+        auto idx = std::min(pos, size() - 1);
+        while (true) {
+            if (vec_[idx] == ch) {
+                return idx;
+            }
+
+            if (idx == 0U) {
+                break;
+            }
+            --idx;
+        }
+        return npos;
+    }
+
+private:
+    void endString()
+    {
+        vec_.emplace_back();
+    }
+
+    StorageType vec_;
+};
+
+template <std::size_t TSize, typename TChar>
+const typename SmallString<TSize, TChar>::size_type SmallString<TSize, TChar>::npos;
+
+/// @brief Lexicographical compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize1, std::size_t TSize2, typename TChar>
+bool operator<(const SmallString<TSize1, TChar>& str1, const SmallString<TSize2, TChar>& str2)
+{
+    return str1.compare(str2) < 0;
+}
+
+/// @brief Lexicographical compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize1, typename TChar>
+bool operator<(const SmallString<TSize1, TChar>& str1, const TChar* str2)
+{
+    return str1.compare(str2) < 0;
+}
+
+/// @brief Lexicographical compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize1, typename TChar>
+bool operator<(const TChar* str1, const SmallString<TSize1, TChar>& str2)
+{
+    return 0 < str2.compare(str1);
+}
+
+/// @brief Lexicographical compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize1, std::size_t TSize2, typename TChar>
+bool operator<=(const SmallString<TSize1, TChar>& str1, const SmallString<TSize2, TChar>& str2)
+{
+    return !(str2 < str1);
+}
+
+/// @brief Lexicographical compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize1, std::size_t TSize2, typename TChar>
+bool operator>(const SmallString<TSize1, TChar>& str1, const SmallString<TSize2, TChar>& str2)
+{
+    return (str2 < str1);
+}
+
+/// @brief Lexicographical compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize1, std::size_t TSize2, typename TChar>
+bool operator>=(const SmallString<TSize1, TChar>& str1, const SmallString<TSize2, TChar>& str2)
+{
+    return !(str1 < str2);
+}
+
+/// @brief Equality compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize1, std::size_t TSize2, typename TChar>
+bool operator==(const SmallString<TSize1, TChar>& str1, const SmallString<TSize2, TChar>& str2)
+{
+    return
+        (str1.size() == str2.size()) &&
+        std::equal(str1.begin(), str1.end(), str2.begin());
+}
+
+/// @brief Equality compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize1, typename TChar>
+bool operator==(const SmallString<TSize1, TChar>& str1, const TChar* str2)
+{
+    return str1.compare(str2) == 0;
+}
+
+/// @brief Equality compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize1, typename TChar>
+bool operator==(const TChar* str1, const SmallString<TSize1, TChar>& str2)
+{
+    return str2 == str1;
+}
+
+/// @brief Inequality compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize1, std::size_t TSize2, typename TChar>
+bool operator!=(const SmallString<TSize1, TChar>& str1, const SmallString<TSize2, TChar>& str2)
+{
+    return !(str1 == str2);
+}
+
+/// @brief Inequality compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize1, typename TChar>
+bool operator!=(const SmallString<TSize1, TChar>& str1, const TChar* str2)
+{
+    return !(str1 == str2);
+}
+
+/// @brief Inequality compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize1, typename TChar>
+bool operator!=(const TChar* str1, const SmallString<TSize1, TChar>& str2)
+{
+    return !(str2 == str1);
+}
+
+namespace details
+{
+
+template <typename T>
+struct IsSmallString
+{
+    static const bool Value = false;
+};
+
+template <std::size_t TSize, typename TChar>
+struct IsSmallString<comms::util::SmallString<TSize, TChar> >
+{
+    static const bool Value = true;
+};
+
+} // namespace details
+
+/// @brief Compile time check whether the provided type is a variant of
+///     @ref comms::util::SmallString
+/// @related comms::util::SmallString
+template <typename T>
+static constexpr bool isSmallString()
+{
+    return details::IsSmallString<T>::Value;
+}
+
+}  // namespace util
+
+}  // namespace comms
+
+namespace std
+{
+
+/// @brief Specializes the std::swap algorithm.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/swap2">Reference</a>
+/// @related comms::util::SmallString
+template <std::size_t TSize, typename TChar>
+void swap(comms::util::SmallString<TSize, TChar>& str1, comms::util::SmallString<TSize, TChar>& str2)
+{
+    str1.swap(str2);
+}
+
+}  // namespace std
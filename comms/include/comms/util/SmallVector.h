@@ -0,0 +1,841 @@
+//
+// Copyright 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of @ref comms::util::SmallVector
+
+#pragma once
+
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <initializer_list>
+
+#include "comms/Assert.h"
+
+namespace comms
+{
+
+namespace util
+{
+
+/// @brief Replacement to <a href="http://en.cppreference.com/w/cpp/container/vector">std::vector</a>
+///     with small buffer optimisation.
+/// @details Stores up to @b TSize elements in the embedded (uninitialised) storage
+///     area, and moves them to the dynamically allocated buffer only when
+///     the number of elements exceeds this limit. Provides
+///     almost the same interface as
+///     <a href="http://en.cppreference.com/w/cpp/container/vector">std::vector</a>.
+/// @tparam T Type of the stored elements.
+/// @tparam TSize Number of elements that can be stored without dynamic memory allocation.
+/// @headerfile "comms/util/SmallVector.h"
+template <typename T, std::size_t TSize>
+class SmallVector
+{
+    static_assert(0U < TSize, "Size of the embedded storage must be greater than 0");
+
+    using CellType =
+        typename std::aligned_storage<
+            sizeof(T),
+            std::alignment_of<T>::value
+        >::type;
+
+    static_assert(sizeof(CellType) == sizeof(T), "Type T must be padded");
+
+    template <typename U, std::size_t TOtherSize>
+    friend class SmallVector;
+
+public:
+    /// @brief Type of single element.
+    using value_type = T;
+
+    /// @brief Type used for size information
+    using size_type = std::size_t;
+
+    /// @brief Type used in pointer arithmetics
+    using difference_type = std::ptrdiff_t;
+
+    /// @brief Reference to single element
+    using reference = T&;
+
+    /// @brief Const reference to single element
+    using const_reference = const T&;
+
+    /// @brief Pointer to single element
+    using pointer = T*;
+
+    /// @brief Const pointer to single element
+    using const_pointer = const T*;
+
+    /// @brief Type of the iterator.
+    using iterator = pointer;
+
+    /// @brief Type of the const iterator
+    using const_iterator = const_pointer;
+
+    /// @brief Type of the reverse iterator
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+    /// @brief Type of the const reverse iterator
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /// @brief Default constructor.
+    SmallVector()
+      : data_(inlineData())
+    {
+    }
+
+    /// @brief Constructor
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/vector">Reference</a>
+    SmallVector(size_type count, const T& value)
+      : SmallVector()
+    {
+        assign(count, value);
+    }
+
+    /// @brief Constructor
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/vector">Reference</a>
+    explicit SmallVector(size_type count)
+      : SmallVector()
+    {
+        resize(count);
+    }
+
+    /// @brief Constructor
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/vector">Reference</a>
+    template <typename TIter>
+    SmallVector(TIter from, TIter to)
+      : SmallVector()
+    {
+        assign(from, to);
+    }
+
+    /// @brief Copy constructor
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/vector">Reference</a>
+    template <std::size_t TOtherSize>
+    SmallVector(const SmallVector<T, TOtherSize>& other)
+      : SmallVector()
+    {
+        assign(other.begin(), other.end());
+    }
+
+    /// @brief Copy constructor
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/vector">Reference</a>
+    SmallVector(const SmallVector& other)
+      : SmallVector()
+    {
+        assign(other.begin(), other.end());
+    }
+
+    /// @brief Move constructor
+    /// @details If the elements of the other vector reside in the dynamically
+    ///     allocated buffer, its ownership is transferred without any copy.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/vector">Reference</a>
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+      : SmallVector()
+    {
+        takeFrom(other);
+    }
+
+    /// @brief Constructor
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/vector">Reference</a>
+    SmallVector(std::initializer_list<value_type> init)
+      : SmallVector()
+    {
+        assign(init.begin(), init.end());
+    }
+
+    /// @brief Destructor
+    ~SmallVector() noexcept
+    {
+        clear();
+        releaseHeap();
+    }
+
+    /// @brief Copy assignement
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator%3D">Reference</a>
+    SmallVector& operator=(const SmallVector& other)
+    {
+        if (&other != this) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    /// @brief Copy assignement
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator%3D">Reference</a>
+    template <std::size_t TOtherSize>
+    SmallVector& operator=(const SmallVector<T, TOtherSize>& other)
+    {
+        assign(other.begin(), other.end());
+        return *this;
+    }
+
+    /// @brief Move assignement
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator%3D">Reference</a>
+    SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+    {
+        if (&other != this) {
+            clear();
+            takeFrom(other);
+        }
+        return *this;
+    }
+
+    /// @brief Copy assignement
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator%3D">Reference</a>
+    SmallVector& operator=(std::initializer_list<value_type> init)
+    {
+        assign(init.begin(), init.end());
+        return *this;
+    }
+
+    /// @brief Assigns values to the container.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/assign">Reference</a>
+    void assign(size_type count, const T& value)
+    {
+        clear();
+        reserve(count);
+        std::uninitialized_fill_n(data_, count, value);
+        size_ = count;
+    }
+
+    /// @brief Assigns values to the container.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/assign">Reference</a>
+    template <typename TIter>
+    void assign(TIter from, TIter to)
+    {
+        using Tag = typename std::iterator_traits<TIter>::iterator_category;
+        clear();
+        assignInternal(from, to, Tag());
+    }
+
+    /// @brief Assigns values to the container.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/assign">Reference</a>
+    void assign(std::initializer_list<value_type> init)
+    {
+        assign(init.begin(), init.end());
+    }
+
+    /// @brief Access specified element with bounds checking.
+    /// @details The bounds check is performed with COMMS_ASSERT() macro, which means
+    ///     it is performed only in DEBUG mode compilation. In case NDEBUG
+    ///     symbol is defined (RELEASE mode compilation), this call is equivalent
+    ///     to operator[]().
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/at">Reference</a>
+    reference at(size_type pos)
+    {
+        COMMS_ASSERT(pos < size());
+        return data_[pos];
+    }
+
+    /// @brief Access specified element with bounds checking.
+    /// @details The bounds check is performed with COMMS_ASSERT() macro, which means
+    ///     it is performed only in DEBUG mode compilation. In case NDEBUG
+    ///     symbol is defined (RELEASE mode compilation), this call is equivalent
+    ///     to operator[]().
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/at">Reference</a>
+    const_reference at(size_type pos) const
+    {
+        COMMS_ASSERT(pos < size());
+        return data_[pos];
+    }
+
+    /// @brief Access specified element without bounds checking.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_at">Reference</a>
+    reference operator[](size_type pos)
+    {
+        return data_[pos];
+    }
+
+    /// @brief Access specified element without bounds checking.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_at">Reference</a>
+    const_reference operator[](size_type pos) const
+    {
+        return data_[pos];
+    }
+
+    /// @brief Access the first element.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/front">Reference</a>
+    /// @pre The vector is not empty.
+    reference front()
+    {
+        COMMS_ASSERT(!empty());
+        return data_[0];
+    }
+
+    /// @brief Access the first element.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/front">Reference</a>
+    /// @pre The vector is not empty.
+    const_reference front() const
+    {
+        COMMS_ASSERT(!empty());
+        return data_[0];
+    }
+
+    /// @brief Access the last element.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/back">Reference</a>
+    /// @pre The vector is not empty.
+    reference back()
+    {
+        COMMS_ASSERT(!empty());
+        return data_[size_ - 1];
+    }
+
+    /// @brief Access the last element.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/back">Reference</a>
+    /// @pre The vector is not empty.
+    const_reference back() const
+    {
+        COMMS_ASSERT(!empty());
+        return data_[size_ - 1];
+    }
+
+    /// @brief Direct access to the underlying array.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/data">Reference</a>
+    pointer data()
+    {
+        return data_;
+    }
+
+    /// @brief Direct access to the underlying array.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/data">Reference</a>
+    const_pointer data() const
+    {
+        return data_;
+    }
+
+    /// @brief Returns an iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/begin">Reference</a>
+    iterator begin()
+    {
+        return data_;
+    }
+
+    /// @brief Returns an iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/begin">Reference</a>
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    /// @brief Returns an iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/begin">Reference</a>
+    const_iterator cbegin() const
+    {
+        return data_;
+    }
+
+    /// @brief Returns an iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/end">Reference</a>
+    iterator end()
+    {
+        return data_ + size_;
+    }
+
+    /// @brief Returns an iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/end">Reference</a>
+    const_iterator end() const
+    {
+        return cend();
+    }
+
+    /// @brief Returns an iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/end">Reference</a>
+    const_iterator cend() const
+    {
+        return data_ + size_;
+    }
+
+    /// @brief Returns a reverse iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/rbegin">Reference</a>
+    reverse_iterator rbegin()
+    {
+        return reverse_iterator(end());
+    }
+
+    /// @brief Returns a reverse iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/rbegin">Reference</a>
+    const_reverse_iterator rbegin() const
+    {
+        return crbegin();
+    }
+
+    /// @brief Returns a reverse iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/rbegin">Reference</a>
+    const_reverse_iterator crbegin() const
+    {
+        return const_reverse_iterator(cend());
+    }
+
+    /// @brief Returns a reverse iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/rend">Reference</a>
+    reverse_iterator rend()
+    {
+        return reverse_iterator(begin());
+    }
+
+    /// @brief Returns a reverse iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/rend">Reference</a>
+    const_reverse_iterator rend() const
+    {
+        return crend();
+    }
+
+    /// @brief Returns a reverse iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/rend">Reference</a>
+    const_reverse_iterator crend() const
+    {
+        return const_reverse_iterator(cbegin());
+    }
+
+    /// @brief Checks whether the container is empty.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/empty">Reference</a>
+    bool empty() const
+    {
+        return size_ == 0U;
+    }
+
+    /// @brief Returns the number of elements.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/size">Reference</a>
+    size_type size() const
+    {
+        return size_;
+    }
+
+    /// @brief Returns the maximum possible number of elements.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/max_size">Reference</a>
+    size_type max_size() const
+    {
+        return std::numeric_limits<size_type>::max() / sizeof(T);
+    }
+
+    /// @brief Reserves storage.
+    /// @details Dynamic memory allocation is performed only if the requested
+    ///     capacity exceeds the one of currently used storage area.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/reserve">Reference</a>
+    void reserve(size_type new_cap)
+    {
+        if (capacity_ < new_cap) {
+            relocate(new_cap);
+        }
+    }
+
+    /// @brief Returns the number of elements that can be held in currently allocated storage.
+    /// @details Never less than @b TSize.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/capacity">Reference</a>
+    size_type capacity() const
+    {
+        return capacity_;
+    }
+
+    /// @brief Reduces memory usage by freeing unused memory.
+    /// @details Moves the elements back into the embedded storage area
+    ///     if they fit.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/shrink_to_fit">Reference</a>
+    void shrink_to_fit()
+    {
+        if (isInline() || (size_ == capacity_)) {
+            return;
+        }
+
+        relocate(size_);
+    }
+
+    /// @brief Clears the contents.
+    /// @details Doesn't release the dynamically allocated buffer (if such exists).
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/clear">Reference</a>
+    void clear()
+    {
+        destroy(data_, data_ + size_);
+        size_ = 0U;
+    }
+
+    /// @brief Inserts elements.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/insert">Reference</a>
+    iterator insert(const_iterator iter, const T& value)
+    {
+        return emplace(iter, value);
+    }
+
+    /// @brief Inserts elements.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/insert">Reference</a>
+    iterator insert(const_iterator iter, T&& value)
+    {
+        return emplace(iter, std::move(value));
+    }
+
+    /// @brief Inserts elements.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/insert">Reference</a>
+    iterator insert(const_iterator iter, size_type count, const T& value)
+    {
+        auto idx = indexOf(iter);
+        T copy(value);
+        reserve(size_ + count);
+        std::uninitialized_fill_n(end(), count, copy);
+        size_ += count;
+        return rotateTail(idx, count);
+    }
+
+    /// @brief Inserts elements.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/insert">Reference</a>
+    template <typename TIter>
+    iterator insert(const_iterator iter, TIter from, TIter to)
+    {
+        auto idx = indexOf(iter);
+        auto prevSize = size_;
+        for (auto it = from; it != to; ++it) {
+            emplace_back(*it);
+        }
+        return rotateTail(idx, size_ - prevSize);
+    }
+
+    /// @brief Inserts elements.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/insert">Reference</a>
+    iterator insert(const_iterator iter, std::initializer_list<value_type> init)
+    {
+        return insert(iter, init.begin(), init.end());
+    }
+
+    /// @brief Constructs elements in place.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/emplace">Reference</a>
+    template <typename... TArgs>
+    iterator emplace(const_iterator iter, TArgs&&... args)
+    {
+        auto idx = indexOf(iter);
+        emplace_back(std::forward<TArgs>(args)...);
+        return rotateTail(idx, 1U);
+    }
+
+    /// @brief Erases elements.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/erase">Reference</a>
+    iterator erase(const_iterator iter)
+    {
+        return erase(iter, iter + 1);
+    }
+
+    /// @brief Erases elements.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/erase">Reference</a>
+    iterator erase(const_iterator from, const_iterator to)
+    {
+        COMMS_ASSERT(from <= to);
+        COMMS_ASSERT(to <= cend());
+        auto* first = begin() + indexOf(from);
+        auto* last = begin() + indexOf(to);
+        auto* newEnd = std::move(last, end(), first);
+        destroy(newEnd, end());
+        size_ -= static_cast<size_type>(std::distance(first, last));
+        return first;
+    }
+
+    /// @brief Adds an element to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/push_back">Reference</a>
+    void push_back(const T& value)
+    {
+        emplace_back(value);
+    }
+
+    /// @brief Adds an element to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/push_back">Reference</a>
+    void push_back(T&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    /// @brief Constructs an element in place at the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/emplace_back">Reference</a>
+    template <typename... TArgs>
+    void emplace_back(TArgs&&... args)
+    {
+        if (size_ < capacity_) {
+            new (data_ + size_) T(std::forward<TArgs>(args)...);
+            ++size_;
+            return;
+        }
+
+        // The arguments may refer to one of the existing elements,
+        // construct the new one before relocation.
+        T elem(std::forward<TArgs>(args)...);
+        relocate(capacity_ * 2);
+        new (data_ + size_) T(std::move(elem));
+        ++size_;
+    }
+
+    /// @brief Removes the last element.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/pop_back">Reference</a>
+    /// @pre The vector mustn't be empty.
+    void pop_back()
+    {
+        COMMS_ASSERT(!empty());
+        --size_;
+        data_[size_].~T();
+    }
+
+    /// @brief Changes the number of elements stored.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/resize">Reference</a>
+    void resize(size_type count)
+    {
+        if (count <= size_) {
+            destroy(data_ + count, end());
+            size_ = count;
+            return;
+        }
+
+        reserve(count);
+        while (size_ < count) {
+            new (data_ + size_) T();
+            ++size_;
+        }
+    }
+
+    /// @brief Changes the number of elements stored.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/resize">Reference</a>
+    void resize(size_type count, const value_type& value)
+    {
+        if (count <= size_) {
+            destroy(data_ + count, end());
+            size_ = count;
+            return;
+        }
+
+        T copy(value);
+        reserve(count);
+        std::uninitialized_fill_n(end(), count - size_, copy);
+        size_ = count;
+    }
+
+    /// @brief Swaps the contents.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/swap">Reference</a>
+    void swap(SmallVector& other)
+    {
+        SmallVector tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+private:
+    pointer inlineData()
+    {
+        return reinterpret_cast<pointer>(&inline_[0]);
+    }
+
+    bool isInline() const
+    {
+        return data_ == reinterpret_cast<const_pointer>(&inline_[0]);
+    }
+
+    size_type indexOf(const_iterator iter) const
+    {
+        COMMS_ASSERT(cbegin() <= iter);
+        COMMS_ASSERT(iter <= cend());
+        return static_cast<size_type>(std::distance(cbegin(), iter));
+    }
+
+    iterator rotateTail(size_type idx, size_type count)
+    {
+        auto* pos = begin() + idx;
+        std::rotate(pos, end() - count, end());
+        return pos;
+    }
+
+    static void destroy(pointer from, pointer to)
+    {
+        for (auto* iter = from; iter != to; ++iter) {
+            iter->~T();
+        }
+    }
+
+    void releaseHeap()
+    {
+        if (!isInline()) {
+            ::operator delete(data_);
+            data_ = inlineData();
+            capacity_ = TSize;
+        }
+    }
+
+    void relocate(size_type newCap)
+    {
+        COMMS_ASSERT(size_ <= newCap);
+        pointer newData = inlineData();
+        if (TSize < newCap) {
+            newData = static_cast<pointer>(::operator new(newCap * sizeof(T)));
+        }
+        else {
+            newCap = TSize;
+        }
+
+        if (newData == data_) {
+            return;
+        }
+
+        for (auto idx = 0U; idx < size_; ++idx) {
+            new (newData + idx) T(std::move(data_[idx]));
+            data_[idx].~T();
+        }
+
+        releaseHeap();
+        data_ = newData;
+        capacity_ = newCap;
+    }
+
+    void takeFrom(SmallVector& other)
+    {
+        COMMS_ASSERT(empty());
+        if (!other.isInline()) {
+            releaseHeap();
+            data_ = other.data_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inlineData();
+            other.size_ = 0U;
+            other.capacity_ = TSize;
+            return;
+        }
+
+        for (auto idx = 0U; idx < other.size_; ++idx) {
+            new (data_ + idx) T(std::move(other.data_[idx]));
+        }
+        size_ = other.size_;
+        other.clear();
+    }
+
+    template <typename TIter>
+    void assignInternal(TIter from, TIter to, std::input_iterator_tag)
+    {
+        for (auto iter = from; iter != to; ++iter) {
+            emplace_back(*iter);
+        }
+    }
+
+    template <typename TIter>
+    void assignInternal(TIter from, TIter to, std::forward_iterator_tag)
+    {
+        auto count = static_cast<size_type>(std::distance(from, to));
+        reserve(count);
+        std::uninitialized_copy(from, to, data_);
+        size_ = count;
+    }
+
+    CellType inline_[TSize];
+    pointer data_ = nullptr;
+    size_type size_ = 0U;
+    size_type capacity_ = TSize;
+};
+
+/// @brief Lexicographically compares the values in the vector.
+/// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_cmp">Reference</a>
+/// @related SmallVector
+template <typename T, std::size_t TSize1, std::size_t TSize2>
+bool operator<(const SmallVector<T, TSize1>& v1, const SmallVector<T, TSize2>& v2)
+{
+    return std::lexicographical_compare(v1.begin(), v1.end(), v2.begin(), v2.end());
+}
+
+/// @brief Lexicographically compares the values in the vector.
+/// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_cmp">Reference</a>
+/// @related SmallVector
+template <typename T, std::size_t TSize1, std::size_t TSize2>
+bool operator<=(const SmallVector<T, TSize1>& v1, const SmallVector<T, TSize2>& v2)
+{
+    return !(v2 < v1);
+}
+
+/// @brief Lexicographically compares the values in the vector.
+/// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_cmp">Reference</a>
+/// @related SmallVector
+template <typename T, std::size_t TSize1, std::size_t TSize2>
+bool operator>(const SmallVector<T, TSize1>& v1, const SmallVector<T, TSize2>& v2)
+{
+    return v2 < v1;
+}
+
+/// @brief Lexicographically compares the values in the vector.
+/// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_cmp">Reference</a>
+/// @related SmallVector
+template <typename T, std::size_t TSize1, std::size_t TSize2>
+bool operator>=(const SmallVector<T, TSize1>& v1, const SmallVector<T, TSize2>& v2)
+{
+    return !(v1 < v2);
+}
+
+/// @brief Lexicographically compares the values in the vector.
+/// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_cmp">Reference</a>
+/// @related SmallVector
+template <typename T, std::size_t TSize1, std::size_t TSize2>
+bool operator==(const SmallVector<T, TSize1>& v1, const SmallVector<T, TSize2>& v2)
+{
+    return (v1.size() == v2.size()) &&
+           std::equal(v1.begin(), v1.end(), v2.begin());
+}
+
+/// @brief Lexicographically compares the values in the vector.
+/// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_cmp">Reference</a>
+/// @related SmallVector
+template <typename T, std::size_t TSize1, std::size_t TSize2>
+bool operator!=(const SmallVector<T, TSize1>& v1, const SmallVector<T, TSize2>& v2)
+{
+    return !(v1 == v2);
+}
+
+namespace details
+{
+
+template <typename T>
+struct IsSmallVector
+{
+    static const bool Value = false;
+};
+
+template <typename T, std::size_t TSize>
+struct IsSmallVector<comms::util::SmallVector<T, TSize> >
+{
+    static const bool Value = true;
+};
+
+} // namespace details
+
+/// @brief Compile time check whether the provided type is a variant of
+///     @ref comms::util::SmallVector
+/// @related comms::util::SmallVector
+template <typename T>
+static constexpr bool isSmallVector()
+{
+    return details::IsSmallVector<T>::Value;
+}
+
+}  // namespace util
+
+}  // namespace comms
+
+namespace std
+{
+
+/// @brief Specializes the std::swap algorithm.
+/// @see <a href="http://en.cppreference.com/w/cpp/container/vector/swap2">Reference</a>
+/// @related comms::util::SmallVector
+template <typename T, std::size_t TSize>
+void swap(comms::util::SmallVector<T, TSize>& v1, comms::util::SmallVector<T, TSize>& v2)
+{
+    v1.swap(v2);
+}
+
+}
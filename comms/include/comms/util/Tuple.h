@@ -97,6 +97,40 @@ public:
 
 //----------------------------------------
 
+/// @brief Calculate index of the first occurrence of TType type in the tuple TTuple
+/// @tparam TType Type to look for
+/// @tparam TTuple Tuple
+/// @pre @code IsTuple<TTuple>::Value == true @endcode
+template <typename TType, typename TTuple>
+struct TupleTypeIdx
+{
+    static_assert(IsTuple<TTuple>::Value, "TTuple must be std::tuple");
+
+    /// @brief Index of the type, equals to the size of the tuple when
+    ///     TType is not found in TTuple.
+    static const std::size_t Value = 0U;
+};
+
+/// @cond SKIP_DOC
+template <typename TType, typename TFirst, typename... TRest>
+struct TupleTypeIdx<TType, std::tuple<TFirst, TRest...> >
+{
+    static const std::size_t Value =
+        std::is_same<TType, TFirst>::value ?
+            0U :
+            1U + TupleTypeIdx<TType, std::tuple<TRest...> >::Value;
+};
+
+template <typename TType>
+struct TupleTypeIdx<TType, std::tuple<> >
+{
+    static const std::size_t Value = 0U;
+};
+
+/// @endcond
+
+//----------------------------------------
+
 /// @brief Calculated "aligned union" storage type for all the types in
 ///     provided tuple.
 /// @tparam TTuple Tuple
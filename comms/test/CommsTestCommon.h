@@ -534,6 +534,39 @@ public:
     }
 };
 
+template <typename TMessage>
+class VersionSpecificMessage7 : public
+        comms::MessageBase<
+            TMessage,
+            comms::option::StaticNumIdImpl<MessageType7>,
+            comms::option::FieldsImpl<typename Message7Fields<typename TMessage::Field>::All>,
+            comms::option::MsgType<VersionSpecificMessage7<TMessage> >,
+            comms::option::HasName,
+            comms::option::VersionSpecificImpl<4, 5, 11>
+        >
+{
+    using Base =
+        comms::MessageBase<
+            TMessage,
+            comms::option::StaticNumIdImpl<MessageType7>,
+            comms::option::FieldsImpl<typename Message7Fields<typename TMessage::Field>::All>,
+            comms::option::MsgType<VersionSpecificMessage7<TMessage> >,
+            comms::option::HasName,
+            comms::option::VersionSpecificImpl<4, 5, 11>
+        >;
+public:
+    COMMS_MSG_FIELDS_NAMES(value1, value2);
+
+    VersionSpecificMessage7() = default;
+
+    ~VersionSpecificMessage7() noexcept = default;
+
+    static const char* doName()
+    {
+        return "VersionSpecificMessage7";
+    }
+};
+
 template <typename TField>
 struct Message8Fields
 {
@@ -668,6 +701,39 @@ public:
 
 
 
+template <typename TMessage>
+class CachedLengthMessage9 : public
+        comms::MessageBase<
+            TMessage,
+            comms::option::StaticNumIdImpl<MessageType9>,
+            comms::option::FieldsImpl<typename Message9Fields<typename TMessage::Field>::All>,
+            comms::option::MsgType<CachedLengthMessage9<TMessage> >,
+            comms::option::HasName,
+            comms::option::CachedLength
+        >
+{
+    using Base =
+        comms::MessageBase<
+            TMessage,
+            comms::option::StaticNumIdImpl<MessageType9>,
+            comms::option::FieldsImpl<typename Message9Fields<typename TMessage::Field>::All>,
+            comms::option::MsgType<CachedLengthMessage9<TMessage> >,
+            comms::option::HasName,
+            comms::option::CachedLength
+        >;
+public:
+    COMMS_MSG_FIELDS_NAMES(f1);
+
+    CachedLengthMessage9() = default;
+
+    ~CachedLengthMessage9() noexcept = default;
+
+    static const char* doName()
+    {
+        return "CachedLengthMessage9";
+    }
+};
+
 template <typename TField>
 struct Message90_1Fields
 {
@@ -43,23 +43,25 @@ const int FlushInterval = 1000;
 
 AppMgr::AppMgr()
 {
-    m_msgMgr.setMsgAddedCallbackFunc(
-        [this](cc::MessagePtr msg)
+    m_msgMgr.setMsgsAddedCallbackFunc(
+        [this](const cc::MsgMgr::MessagesList& msgs)
         {
-            if (!msg) {
-                assert(!"Application message wasn't provided");
-                return;
-            }
-
-            auto type = cc::property::message::Type().getFrom(*msg);
-            assert((type == cc::Message::Type::Sent) ||
-                   (type == cc::Message::Type::Received));
-            if ((type == cc::Message::Type::Sent) &&
-                (!m_config.m_recordOutgoing)) {
-                return;
+            for (auto& msg : msgs) {
+                if (!msg) {
+                    assert(!"Application message wasn't provided");
+                    continue;
+                }
+
+                auto type = cc::property::message::Type().getFrom(*msg);
+                assert((type == cc::Message::Type::Sent) ||
+                       (type == cc::Message::Type::Received));
+                if ((type == cc::Message::Type::Sent) &&
+                    (!m_config.m_recordOutgoing)) {
+                    continue;
+                }
+
+                dispatchMsg(*msg);
             }
-
-            dispatchMsg(*msg);
         });
 
     m_msgSendMgr.setSendMsgsCallbackFunc(
@@ -176,6 +178,7 @@ bool AppMgr::applyPlugins(const ListOfPluginInfos& plugins)
         cc::SocketPtr m_socket;
         ListOfFilters m_filters;
         cc::ProtocolPtr m_protocol;
+        cc::ProtocolPtr m_decodeProtocol;
     };
 
     auto applyInfo = ApplyInfo();
@@ -194,6 +197,9 @@ bool AppMgr::applyPlugins(const ListOfPluginInfos& plugins)
 
         if (!applyInfo.m_protocol) {
             applyInfo.m_protocol = plugin->createProtocol();
+            if (applyInfo.m_protocol) {
+                applyInfo.m_decodeProtocol = plugin->createProtocol();
+            }
         }
     }
 
@@ -214,6 +220,7 @@ bool AppMgr::applyPlugins(const ListOfPluginInfos& plugins)
     }
 
     m_msgMgr.setProtocol(std::move(applyInfo.m_protocol));
+    m_msgMgr.setDecodeProtocol(std::move(applyInfo.m_decodeProtocol));
 
     m_pluginMgr.setAppliedPlugins(plugins);
     return true;
@@ -19,6 +19,8 @@
 #include "GuiAppMgr.h"
 
 #include <cassert>
+#include <algorithm>
+#include <iterator>
 #include <memory>
 
 #include "comms/CompileControl.h"
@@ -583,6 +585,7 @@ bool GuiAppMgr::applyNewPlugins(const ListOfPluginInfos& plugins)
         SocketPtr m_socket;
         ListOfFilters m_filters;
         ProtocolPtr m_protocol;
+        ProtocolPtr m_decodeProtocol;
         ListOfGuiActions m_actions;
     };
 
@@ -602,6 +605,9 @@ bool GuiAppMgr::applyNewPlugins(const ListOfPluginInfos& plugins)
 
         if (!applyInfo.m_protocol) {
             applyInfo.m_protocol = plugin->createProtocol();
+            if (applyInfo.m_protocol) {
+                applyInfo.m_decodeProtocol = plugin->createProtocol();
+            }
         }
 
         auto guiActions = plugin->createGuiActions();
@@ -633,6 +639,7 @@ bool GuiAppMgr::applyNewPlugins(const ListOfPluginInfos& plugins)
     }
 
     msgMgr.setProtocol(std::move(applyInfo.m_protocol));
+    msgMgr.setDecodeProtocol(std::move(applyInfo.m_decodeProtocol));
 
     msgMgr.start();
     emit sigActivityStateChanged((int)ActivityState::Active);
@@ -676,10 +683,10 @@ GuiAppMgr::GuiAppMgr(QObject* parentObj)
         });
 
     auto& msgMgr = MsgMgrG::instanceRef();
-    msgMgr.setMsgAddedCallbackFunc(
-        [this](MessagePtr msg)
+    msgMgr.setMsgsAddedCallbackFunc(
+        [this](const MessagesList& msgs)
         {
-            msgAdded(std::move(msg));
+            msgsAdded(msgs);
         });
 
     msgMgr.setErrorReportCallbackFunc(
@@ -707,41 +714,35 @@ void GuiAppMgr::emitSendStateUpdate()
     emit sigSetSendState(static_cast<int>(m_sendState));
 }
 
-void GuiAppMgr::msgAdded(MessagePtr msg)
+void GuiAppMgr::msgsAdded(const MessagesList& msgs)
 {
-    assert(msg);
-    auto type = property::message::Type().getFrom(*msg);
-    assert((type == MsgType::Received) || (type == MsgType::Sent));
-
-#ifndef NDEBUG
-
-    static const char* const RecvPrefix = "<-- ";
-    static const char* const SentPrefix = "--> ";
-
-    const char* prefix = RecvPrefix;
-    if (type == MsgType::Sent) {
-        prefix = SentPrefix;
+    MessagesList msgsToAdd;
+    for (auto& msg : msgs) {
+        assert(msg);
+        auto type = property::message::Type().getFrom(*msg);
+        assert((type == MsgType::Received) || (type == MsgType::Sent));
+        if (canAddToRecvList(*msg, type)) {
+            msgsToAdd.push_back(msg);
+        }
     }
 
-    std::cout << prefix << msg->name() << std::endl;
-#endif
-
-    if (!canAddToRecvList(*msg, type)) {
+    if (msgsToAdd.empty()) {
         return;
     }
 
-    addMsgToRecvList(msg);
+    auto lastMsg = msgsToAdd.back();
+    addMsgsToRecvList(msgsToAdd);
 
     if (m_clickedMsg) {
         return;
     }
 
     if (m_pendingDisplayWaitInProgress) {
-        m_pendingDisplayMsg = std::move(msg);
+        m_pendingDisplayMsg = std::move(lastMsg);
         return;
     }
 
-    displayMessage(std::move(msg));
+    displayMessage(std::move(lastMsg));
 
     static const int DisplayTimeout = 250;
     m_pendingDisplayWaitInProgress = true;
@@ -810,18 +811,24 @@ void GuiAppMgr::refreshRecvList()
 
     clearRecvList(false);
 
-    auto& allMsgs = MsgMgrG::instanceRef().getAllMsgs();
-    for (auto& msg : allMsgs) {
+    auto& msgMgr = MsgMgrG::instanceRef();
+    auto positions = getRecvListMsgsPositions();
+    MessagesList msgsToAdd;
+    int clickedIdx = -1;
+    for (auto idx : positions) {
+        auto msg = msgMgr.getMsg(idx);
         assert(msg);
-        auto type = property::message::Type().getFrom(*msg);
+        assert(canAddToRecvList(*msg, property::message::Type().getFrom(*msg)));
 
-        if (canAddToRecvList(*msg, type)) {
-            addMsgToRecvList(msg);
-            if (msg == clickedMsg) {
-                assert(0 < m_recvListCount);
-                recvMsgClicked(msg, m_recvListCount - 1);
-            }
+        if (msg == clickedMsg) {
+            clickedIdx = static_cast<int>(m_recvListCount + msgsToAdd.size());
         }
+        msgsToAdd.push_back(std::move(msg));
+    }
+
+    addMsgsToRecvList(msgsToAdd);
+    if (0 <= clickedIdx) {
+        recvMsgClicked(clickedMsg, clickedIdx);
     }
 
     if (!m_clickedMsg) {
@@ -829,12 +836,15 @@ void GuiAppMgr::refreshRecvList()
     }
 }
 
-void GuiAppMgr::addMsgToRecvList(MessagePtr msg)
+void GuiAppMgr::addMsgsToRecvList(const MessagesList& msgs)
 {
-    assert(msg);
-    ++m_recvListCount;
+    if (msgs.empty()) {
+        return;
+    }
+
+    m_recvListCount += static_cast<unsigned>(msgs.size());
     emit sigRecvListCountReport(m_recvListCount);
-    emit sigAddRecvMsg(msg);
+    emit sigAddRecvMsgs(msgs);
 }
 
 void GuiAppMgr::clearRecvList(bool reportDeleted)
@@ -876,6 +886,43 @@ bool GuiAppMgr::canAddToRecvList(
     return recvListShowsGarbage();
 }
 
+GuiAppMgr::MsgsPositions GuiAppMgr::getRecvListMsgsPositions() const
+{
+    auto& msgMgr = MsgMgrG::instanceRef();
+    auto& received = msgMgr.getMsgsOfType(MsgType::Received);
+    auto& garbage = msgMgr.getMsgsWithId(QString());
+
+    MsgsPositions shownReceived;
+    if (recvListShowsReceived() && recvListShowsGarbage()) {
+        shownReceived = received;
+    }
+    else if (recvListShowsReceived()) {
+        std::set_difference(
+            received.begin(), received.end(),
+            garbage.begin(), garbage.end(),
+            std::back_inserter(shownReceived));
+    }
+    else if (recvListShowsGarbage()) {
+        std::set_intersection(
+            received.begin(), received.end(),
+            garbage.begin(), garbage.end(),
+            std::back_inserter(shownReceived));
+    }
+
+    if (!recvListShowsSent()) {
+        return shownReceived;
+    }
+
+    auto& sent = msgMgr.getMsgsOfType(MsgType::Sent);
+    MsgsPositions result;
+    result.reserve(shownReceived.size() + sent.size());
+    std::merge(
+        shownReceived.begin(), shownReceived.end(),
+        sent.begin(), sent.end(),
+        std::back_inserter(result));
+    return result;
+}
+
 void GuiAppMgr::decRecvListCount()
 {
     --m_recvListCount;
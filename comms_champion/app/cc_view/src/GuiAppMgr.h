@@ -65,6 +65,7 @@ public:
     };
 
     typedef MsgMgr::MsgType MsgType;
+    typedef MsgMgr::MsgsPositions MsgsPositions;
     typedef std::shared_ptr<QAction> ActionPtr;
     typedef PluginMgr::ListOfPluginInfos ListOfPluginInfos;
     typedef Protocol::MessagesList MessagesList;
@@ -153,7 +154,7 @@ public slots:
     void disconnectSocketClicked();
 
 signals:
-    void sigAddRecvMsg(MessagePtr msg);
+    void sigAddRecvMsgs(const MessagesList& msgs);
     void sigAddSendMsg(MessagePtr msg);
     void sigSendMsgUpdated(MessagePtr msg);
     void sigSetRecvState(int state);
@@ -210,7 +211,7 @@ private:
     void emitSendStateUpdate();
 
 private slots:
-    void msgAdded(MessagePtr msg);
+    void msgsAdded(const MessagesList& msgs);
     void errorReported(const QString& msg);
     void socketDisconnected();
     void pendingDisplayTimeout();
@@ -221,9 +222,10 @@ private /*data*/:
     void displayMessage(MessagePtr msg);
     void clearDisplayedMessage();
     void refreshRecvList();
-    void addMsgToRecvList(MessagePtr msg);
+    void addMsgsToRecvList(const MessagesList& msgs);
     void clearRecvList(bool reportDeleted);
     bool canAddToRecvList(const Message& msg, MsgType type) const;
+    MsgsPositions getRecvListMsgsPositions() const;
     void decRecvListCount();
     void decSendListCount();
     void emitRecvNotSelected();
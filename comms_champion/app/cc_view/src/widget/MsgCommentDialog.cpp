@@ -20,6 +20,7 @@
 
 #include <cassert>
 #include "comms_champion/property/message.h"
+#include "MsgMgrG.h"
 
 namespace comms_champion
 {
@@ -37,6 +38,7 @@ MsgCommentDialog::MsgCommentDialog(
 void MsgCommentDialog::accept()
 {
     property::message::Comment().setTo(m_ui.m_commentLineEdit->text(), *m_msg);
+    MsgMgrG::instanceRef().updateMsg(m_msg);
     Base::accept();
 }
 
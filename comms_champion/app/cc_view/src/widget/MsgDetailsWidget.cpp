@@ -122,6 +122,7 @@ void MsgDetailsWidget::widgetScrolled(int value)
     }
 
     property::message::ScrollPos().setTo(value, *m_displayedMsg);
+    MsgMgrG::instanceRef().updateMsg(m_displayedMsg);
 }
 
 } // namespace comms_champion
@@ -70,6 +70,26 @@ MsgListWidget::MsgListWidget(
 }
 
 void MsgListWidget::addMessage(MessagePtr msg)
+{
+    addMessageItem(std::move(msg));
+    messagesItemsAdded();
+}
+
+void MsgListWidget::addMessages(const MessagesList& msgs)
+{
+    if (msgs.empty()) {
+        return;
+    }
+
+    m_ui.m_listWidget->setUpdatesEnabled(false);
+    for (auto& msg : msgs) {
+        addMessageItem(msg);
+    }
+    messagesItemsAdded();
+    m_ui.m_listWidget->setUpdatesEnabled(true);
+}
+
+void MsgListWidget::addMessageItem(MessagePtr msg)
 {
     assert(msg);
     m_ui.m_listWidget->addItem(getMsgNameText(msg));
@@ -89,12 +109,14 @@ void MsgListWidget::addMessage(MessagePtr msg)
     item->setData(
         Qt::UserRole,
         QVariant::fromValue(msg));
+}
 
+void MsgListWidget::messagesItemsAdded()
+{
     if (m_selectOnAdd) {
         m_ui.m_listWidget->blockSignals(true);
         m_ui.m_listWidget->setCurrentRow(m_ui.m_listWidget->count() - 1);
         m_ui.m_listWidget->blockSignals(false);
-        assert(m_ui.m_listWidget->currentItem() == item);
     }
 
     if (m_ui.m_listWidget->currentRow() < 0) {
@@ -53,6 +53,7 @@ public:
 
 protected slots:
     void addMessage(MessagePtr msg);
+    void addMessages(const MessagesList& msgs);
     void updateCurrentMessage(MessagePtr msg);
     void deleteCurrentMessage();
     void selectOnAdd(bool enabled);
@@ -92,6 +93,8 @@ private slots:
     void msgCommentUpdated(MessagePtr msg);
 
 private:
+    void addMessageItem(MessagePtr msg);
+    void messagesItemsAdded();
     MessagePtr getMsgFromItem(QListWidgetItem* item) const;
     QString getMsgNameText(MessagePtr msg);
     Qt::GlobalColor defaultItemColour(bool valid) const;
@@ -81,6 +81,54 @@ public:
     ///     chain
     QList<DataInfoPtr> sendData(DataInfoPtr dataPtr);
 
+    /// @brief Non-owning view of the raw data processed by the span based
+    ///     functions.
+    struct DataSpan
+    {
+        std::uint8_t* m_data; ///< Pointer to the first byte
+        std::size_t m_size; ///< Number of bytes
+    };
+
+    /// @brief Check whether the filter supports span based data processing.
+    /// @details When supported, the recvDataSpan() and sendDataSpan() are
+    ///     preferred over recvData() and sendData(), which avoids allocation
+    ///     of new @ref DataInfo objects. The function invokes virtual
+    ///     supportsDataSpanImpl(), which can be overriden by the derived class.
+    bool supportsDataSpan() const;
+
+    /// @brief Process received data without allocating new @ref DataInfo
+    /// @details The filter either transforms the data in place and updates
+    ///     @b data to reference the result (any sub-range of the original
+    ///     input), or writes the result into @b outBuf and updates @b data to
+    ///     reference its contents. The @b outBuf is a reusable buffer provided
+    ///     by the caller, it is empty but may have preallocated capacity.
+    ///     The function invokes virtual recvDataSpanImpl().
+    /// @param[in, out] data Incoming data, updated to reference the outcome.
+    /// @param[out] outBuf Reusable output buffer.
+    /// @param[in, out] props Extra properties of the data, the filter is
+    ///     expected to add or update only its own entries.
+    /// @return true in case the data needs to be forwarded to the protocol or
+    ///     other filter up the chain, false in case it has been consumed.
+    bool recvDataSpan(
+        DataSpan& data,
+        DataInfo::DataSeq& outBuf,
+        DataInfo::PropertiesMap& props);
+
+    /// @brief Process outgoing data without allocating new @ref DataInfo
+    /// @details Same as recvDataSpan(), but for the data generated by the
+    ///     protocol or other filter up the chain. The function invokes
+    ///     virtual sendDataSpanImpl().
+    /// @param[in, out] data Outgoing data, updated to reference the outcome.
+    /// @param[out] outBuf Reusable output buffer.
+    /// @param[in, out] props Extra properties of the data, the filter is
+    ///     expected to add or update only its own entries.
+    /// @return true in case the data needs to be forwarded to the I/O socket
+    ///     or other filter down the chain, false in case it has been consumed.
+    bool sendDataSpan(
+        DataSpan& data,
+        DataInfo::DataSeq& outBuf,
+        DataInfo::PropertiesMap& props);
+
     /// @brief Type of callback to report outgoing data.
     using DataToSendCallback = std::function<void (DataInfoPtr)>;
 
@@ -127,6 +175,28 @@ protected:
     ///     class
     virtual QList<DataInfoPtr> sendDataImpl(DataInfoPtr dataPtr) = 0;
 
+    /// @brief Polymorphic check of the span based processing support.
+    /// @details Invoked by supportsDataSpan(). Default implementation
+    ///     returns false. The derived class overriding it to return true,
+    ///     must also override recvDataSpanImpl() and sendDataSpanImpl().
+    virtual bool supportsDataSpanImpl() const;
+
+    /// @brief Polymorphic span based processing of incoming data.
+    /// @details Invoked by recvDataSpan(). Default implementation does
+    ///     nothing and returns false.
+    virtual bool recvDataSpanImpl(
+        DataSpan& data,
+        DataInfo::DataSeq& outBuf,
+        DataInfo::PropertiesMap& props);
+
+    /// @brief Polymorphic span based processing of outgoing data.
+    /// @details Invoked by sendDataSpan(). Default implementation does
+    ///     nothing and returns false.
+    virtual bool sendDataSpanImpl(
+        DataSpan& data,
+        DataInfo::DataSeq& outBuf,
+        DataInfo::PropertiesMap& props);
+
     /// @brief Report new data to send generated by the filter itself.
     /// @details This function needs to be invoked by the derived class when
     ///     when it has new data to be sent over I/O link. This function
@@ -65,7 +65,8 @@ protected:
     virtual const char*
     nameImpl() const override
     {
-        if (property::message::TransportMsg().getFrom(*this)) {
+        if (property::message::ReceivedFrame().getFrom(*this) ||
+            property::message::TransportMsg().getFrom(*this)) {
             static const char* InvalidMsgStr = "???";
             return InvalidMsgStr;
         }
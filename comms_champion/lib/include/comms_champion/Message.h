@@ -28,6 +28,7 @@ CC_DISABLE_WARNINGS()
 #include <QtCore/QObject>
 #include <QtCore/QVariantList>
 #include <QtCore/QVariantMap>
+#include <QtCore/QString>
 CC_ENABLE_WARNINGS()
 
 #include "Api.h"
@@ -37,6 +38,7 @@ namespace comms_champion
 
 class MessageHandler;
 class MessageWidget;
+class ReceivedFrame;
 
 /// @brief Main interface class used by <b>CommsChampion Tools</b>
 ///     to display and manipulate messages.
@@ -56,10 +58,75 @@ public:
         NumOfValues ///< Number of available values
     };
 
+    /// @brief Storage of the well known message properties.
+    /// @details Accessed by the property classes defined in
+    ///     @b comms_champion/property/message.h instead of going through
+    ///     the dynamic properties of the @b QObject. The dynamic properties
+    ///     are still used for any other (plugin defined) properties.
+    struct Metadata
+    {
+        /// @brief Index of the bit in @ref m_presence reporting
+        ///     that the relevant value has been assigned.
+        enum Slot : unsigned
+        {
+            Slot_SeqNumber, ///< @ref m_seqNumber
+            Slot_Type, ///< @ref m_type
+            Slot_Timestamp, ///< @ref m_timestamp
+            Slot_ProtocolName, ///< @ref m_protocolName
+            Slot_TransportMsg, ///< @ref m_transportMsg
+            Slot_RawDataMsg, ///< @ref m_rawDataMsg
+            Slot_ReceivedFrame, ///< @ref m_receivedFrame
+            Slot_ExtraInfoMsg, ///< @ref m_extraInfoMsg
+            Slot_ExtraInfo, ///< @ref m_extraInfo
+            Slot_ForceExtraInfoExistence, ///< @ref m_forceExtraInfoExistence
+            Slot_Delay, ///< @ref m_delay
+            Slot_DelayUnits, ///< @ref m_delayUnits
+            Slot_RepeatDuration, ///< @ref m_repeatDuration
+            Slot_RepeatDurationUnits, ///< @ref m_repeatDurationUnits
+            Slot_RepeatCount, ///< @ref m_repeatCount
+            Slot_ScrollPos, ///< @ref m_scrollPos
+            Slot_Comment, ///< @ref m_comment
+            Slot_NumOfValues ///< Number of available slots
+        };
+
+        unsigned long long m_seqNumber = 0U; ///< Sequence number assigned by message manager
+        unsigned m_type = 0U; ///< Message type (see @ref Message::Type)
+        unsigned long long m_timestamp = 0U; ///< Timestamp in milliseconds since epoch
+        QString m_protocolName; ///< Name of the protocol
+        std::shared_ptr<Message> m_transportMsg; ///< "Transport" message
+        std::shared_ptr<Message> m_rawDataMsg; ///< "Raw data" message
+        std::shared_ptr<ReceivedFrame> m_receivedFrame; ///< Received frame
+        std::shared_ptr<Message> m_extraInfoMsg; ///< "Extra info" message
+        QVariantMap m_extraInfo; ///< Extra info properties
+        bool m_forceExtraInfoExistence = false; ///< Force "extra info" message existence
+        unsigned long long m_delay = 0U; ///< Send delay
+        QString m_delayUnits; ///< Units of the send delay
+        unsigned long long m_repeatDuration = 0U; ///< Repeat duration
+        QString m_repeatDurationUnits; ///< Units of the repeat duration
+        unsigned m_repeatCount = 0U; ///< Repeat count
+        int m_scrollPos = 0; ///< Scroll position of the message display
+        QString m_comment; ///< Comment
+        std::uint32_t m_presence = 0U; ///< Bitmask of assigned values (see @ref Slot)
+    };
+
+    static_assert(Metadata::Slot_NumOfValues <= 32U, "Presence bitmask is too short");
+
     /// @brief Destructor
     /// @details virtual to allow polymorphic destruction
     virtual ~Message() noexcept;
 
+    /// @brief Access storage of the well known properties.
+    Metadata& metadata()
+    {
+        return m_metadata;
+    }
+
+    /// @brief Access storage of the well known properties.
+    const Metadata& metadata() const
+    {
+        return m_metadata;
+    }
+
     /// @brief Get message name
     /// @details Invokes virtual nameImpl().
     const char* name() const;
@@ -155,6 +222,9 @@ protected:
     /// @brief Polymorphic deserialisation functionality.
     /// @details Invoked by decodeData().
     virtual bool decodeDataImpl(const DataSeq& data) = 0;
+
+private:
+    Metadata m_metadata;
 };
 
 /// @brief Smart pointer to @ref Message
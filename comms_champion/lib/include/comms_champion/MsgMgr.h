@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -39,6 +40,8 @@ public:
     typedef Protocol::MessagesList MessagesList;
 
     typedef Message::Type MsgType;
+    typedef std::vector<std::uint32_t> MsgsPositions;
+    typedef unsigned long long TimestampType;
 
     MsgMgr();
     ~MsgMgr() noexcept;
@@ -54,20 +57,39 @@ public:
     void deleteMsg(MessagePtr msg);
     void deleteAllMsgs();
 
+    /// @brief Record properties (such as comment or scroll position)
+    ///     assigned to the stored message after it has been added.
+    void updateMsg(MessagePtr msg);
+
     void sendMsgs(MessagesList&& msgs);
 
-    const AllMessages& getAllMsgs() const;
+    std::size_t getMsgsCount() const;
+    MessagePtr getMsg(std::size_t idx) const;
+    AllMessages getAllMsgs() const;
+
+    /// @brief Update the list returned by the previous invocation.
+    /// @details Removes deleted messages and appends new ones without
+    ///     re-creating the ones already in the list.
+    void getAllMsgs(AllMessages& msgs) const;
+
+    const MsgsPositions& getMsgsOfType(MsgType type) const;
+    const MsgsPositions& getMsgsWithId(const QString& id) const;
+    MsgsPositions getMsgsInTimeRange(TimestampType from, TimestampType to) const;
     void addMsgs(const MessagesList& msgs, bool reportAdded = true);
 
     void setSocket(SocketPtr socket);
     void setProtocol(ProtocolPtr protocol);
+    void setDecodeProtocol(ProtocolPtr protocol);
     void addFilter(FilterPtr filter);
 
     typedef std::function<void (MessagePtr msg)> MsgAddedCallbackFunc;
+    typedef std::function<void (const MessagesList& msgs)> MsgsAddedCallbackFunc;
     typedef std::function<void (const QString& error)> ErrorReportCallbackFunc;
     typedef std::function<void ()> SocketDisconnectedReportCallbackFunc;
 
     void setMsgAddedCallbackFunc(MsgAddedCallbackFunc&& func);
+    void setMsgsAddedCallbackFunc(MsgsAddedCallbackFunc&& func);
+    void setMsgsAddedCoalescing(unsigned maxDelayMs, std::size_t maxCount);
     void setErrorReportCallbackFunc(ErrorReportCallbackFunc&& func);
     void setSocketDisconnectReportCallbackFunc(SocketDisconnectedReportCallbackFunc&& func);
 
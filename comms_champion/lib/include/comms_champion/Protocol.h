@@ -34,6 +34,7 @@ CC_ENABLE_WARNINGS()
 #include "Message.h"
 #include "ErrorStatus.h"
 #include "DataInfo.h"
+#include "ReceivedFrame.h"
 
 namespace comms_champion
 {
@@ -76,6 +77,18 @@ public:
     /// @return List of created messages
     MessagesList read(const DataInfo& dataInfo, bool final = false);
 
+    /// @brief Decode single complete frame.
+    /// @details Unlike read(), doesn't use or affect any data
+    ///     pending from the previous read() invocations. Used to re-create
+    ///     the previously received (or sent) message from its raw bytes.
+    ///     Invokes virtual decodeFrameImpl().
+    /// @param[in] dataInfo Raw bytes of the frame and extra properties
+    ///     to be assigned to the message.
+    /// @return Created message, empty pointer if the protocol doesn't support
+    ///     such functionality, for example when its frames depend on
+    ///     the previously received ones.
+    MessagePtr decodeFrame(const DataInfo& dataInfo);
+
     /// @brief Serialse message.
     /// @details Invokes writeImpl().
     /// @param[in] msg Reference to message object, passed by non-const reference
@@ -117,6 +130,11 @@ protected:
     /// @details Invoked by read().
     virtual MessagesList readImpl(const DataInfo& dataInfo, bool final) = 0;
 
+    /// @brief Polymorphic single frame decoding functionality.
+    /// @details Invoked by decodeFrame(). The default implementation returns
+    ///     empty pointer, i.e. the functionality is not supported.
+    virtual MessagePtr decodeFrameImpl(const DataInfo& dataInfo);
+
     /// @brief Polymorphic write functionality.
     /// @details invoked by write().
     virtual DataInfoPtr writeImpl(Message& msg) = 0;
@@ -159,8 +177,17 @@ protected:
     ///     of application message object.
     static void setRawDataToMessageProperties(MessagePtr rawDataMsg, Message& msg);
 
+    /// @brief Helper function to assign "received frame" object as a property
+    ///     of application message object.
+    /// @details The "transport" and "raw data" messages are created from
+    ///     the frame on the first request unless assigned explicitly.
+    static void setReceivedFrameToMessageProperties(ReceivedFramePtr frame, Message& msg);
+
     /// @brief Helper function to assign "extra info message" object as a property
     ///     of application message object.
+    /// @details The same "extra info message" object may be shared between
+    ///     multiple application messages and must not be modified, updateMessage()
+    ///     replaces it with a new one.
     static void setExtraInfoMsgToMessageProperties(MessagePtr extraInfoMsg, Message& msg);
 
     /// @brief Helper function to retrieve "extra info message" object from properties
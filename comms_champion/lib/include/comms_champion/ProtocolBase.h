@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <memory>
 #include <cassert>
 
 
@@ -106,55 +107,89 @@ protected:
     /// @brief Overriding implementation to Protocol::readImpl().
     virtual MessagesList readImpl(const DataInfo& dataInfo, bool final) override
     {
-        const std::uint8_t* iter = &dataInfo.m_data[0];
-        auto size = dataInfo.m_data.size();
+        using ReadIterator = typename ProtocolMessage::ReadIterator;
+        ReadIterator readIterBeg = nullptr;
+        ReadIterator readIterEnd = nullptr;
+
+        // When there is no pending data from the previous call, parse
+        // directly from the received buffer and store only the leftover.
+        bool parsingPending = (m_dataOffset < m_data.size());
+        if (parsingPending) {
+            appendPendingData(dataInfo.m_data);
+            readIterBeg = &m_data[m_dataOffset];
+            readIterEnd = readIterBeg;
+            std::advance(readIterEnd, m_data.size() - m_dataOffset);
+        }
+        else {
+            m_data.clear();
+            m_dataOffset = 0U;
+            if (!dataInfo.m_data.empty()) {
+                readIterBeg = &dataInfo.m_data[0];
+                readIterEnd = readIterBeg;
+                std::advance(readIterEnd, dataInfo.m_data.size());
+            }
+        }
 
         MessagesList allMsgs;
-        m_data.reserve(m_data.size() + size);
-        std::copy_n(iter, size, std::back_inserter(m_data));
 
-        using ReadIterator = typename ProtocolMessage::ReadIterator;
-        ReadIterator readIterBeg = &m_data[0];
+        // The bytes of the parsed frames are copied at most once and shared
+        // by all the received messages.
+        const ReadIterator parsedDataBeg = readIterBeg;
+        ReceivedFrame::DataSeqPtr parsedData;
+        auto parsedDataFunc =
+            [&parsedData, parsedDataBeg, &readIterEnd]() -> ReceivedFrame::DataSeqPtr
+            {
+                if (!parsedData) {
+                    parsedData = std::make_shared<DataInfo::DataSeq>(parsedDataBeg, readIterEnd);
+                }
+                return parsedData;
+            };
 
         auto remainingSizeCalc =
-            [this](ReadIterator readIter) -> std::size_t
+            [&readIterEnd](ReadIterator readIter) -> std::size_t
             {
-                ReadIterator const dataBegin = &m_data[0];
-                auto consumed =
+                return
                     static_cast<std::size_t>(
-                        std::distance(dataBegin, readIter));
-                assert(consumed <= m_data.size());
-                return m_data.size() - consumed;
+                        std::distance(readIter, readIterEnd));
             };
 
-        auto eraseGuard =
+        auto keepRemainingGuard =
             comms::util::makeScopeGuard(
-                [this, &readIterBeg]()
+                [this, &readIterBeg, &readIterEnd, parsingPending]()
                 {
-                    ReadIterator dataBegin = &m_data[0];
-                    auto dist =
+                    auto remSize =
                         static_cast<std::size_t>(
-                            std::distance(dataBegin, readIterBeg));
-                    m_data.erase(m_data.begin(), m_data.begin() + dist);
+                            std::distance(readIterBeg, readIterEnd));
+
+                    if (!parsingPending) {
+                        m_data.assign(readIterBeg, readIterEnd);
+                        return;
+                    }
+
+                    assert(remSize <= m_data.size());
+                    m_dataOffset = m_data.size() - remSize;
+                    if (remSize == 0U) {
+                        m_data.clear();
+                        m_dataOffset = 0U;
+                    }
                 });
 
+        // All the messages decoded from the same chunk share the same
+        // "extra info" message, which is serialised only once.
+        MessagePtr extraInfoMsg;
         auto setExtraInfoFunc =
-            [&dataInfo](Message& msg)
+            [&dataInfo, &extraInfoMsg](Message& msg)
             {
                 if (dataInfo.m_extraProperties.isEmpty()) {
                     return;
                 }
 
-                auto jsonObj = QJsonObject::fromVariantMap(dataInfo.m_extraProperties);
-                QJsonDocument doc(jsonObj);
+                if (!extraInfoMsg) {
+                    extraInfoMsg = createExtraInfoMsg(dataInfo.m_extraProperties);
+                }
 
-                std::unique_ptr<ExtraInfoMsg> extraInfoMsgPtr(new ExtraInfoMsg());
-                auto& str = std::get<0>(extraInfoMsgPtr->fields());
-                str.value() = doc.toJson().constData();
                 setExtraInfoToMessageProperties(dataInfo.m_extraProperties, msg);
-                setExtraInfoMsgToMessageProperties(
-                    MessagePtr(extraInfoMsgPtr.release()),
-                    msg);
+                setExtraInfoMsgToMessageProperties(extraInfoMsg, msg);
             };
 
         auto checkGarbageFunc =
@@ -204,25 +239,17 @@ protected:
                     });
 
             auto setExtrasFunc =
-                [readIterBeg, &readIterCur, &msgPtr, &setExtraInfoFunc]()
+                [readIterBeg, parsedDataBeg, &readIterCur, &msgPtr, &parsedDataFunc, &setExtraInfoFunc]()
                 {
                     // readIterBeg is captured by value on purpose
                     auto dataSize = static_cast<std::size_t>(
                                 std::distance(readIterBeg, readIterCur));
+                    auto dataOffset = static_cast<std::size_t>(
+                                std::distance(parsedDataBeg, readIterBeg));
 
-                    auto readTransportIterBegTmp = readIterBeg;
-                    std::unique_ptr<TransportMsg> transportMsgPtr(new TransportMsg());
-                    auto esTmp = transportMsgPtr->read(readTransportIterBegTmp, dataSize);
-                    static_cast<void>(esTmp);
-                    assert(esTmp == comms::ErrorStatus::Success);
-                    setTransportToMessageProperties(MessagePtr(transportMsgPtr.release()), *msgPtr);
-
-                    auto readRawIterBegTmp = readIterBeg;
-                    std::unique_ptr<RawDataMsg> rawDataMsgPtr(new RawDataMsg());
-                    esTmp = rawDataMsgPtr->read(readRawIterBegTmp, dataSize);
-                    static_cast<void>(esTmp);
-                    assert(esTmp == comms::ErrorStatus::Success);
-                    setRawDataToMessageProperties(MessagePtr(rawDataMsgPtr.release()), *msgPtr);
+                    ReceivedFramePtr frame(
+                        new ProtocolReceivedFrame(parsedDataFunc(), dataOffset, dataSize));
+                    setReceivedFrameToMessageProperties(std::move(frame), *msgPtr);
                     setExtraInfoFunc(*msgPtr);
                 };
 
@@ -259,17 +286,62 @@ protected:
         }
 
         if (final) {
-            ReadIterator dataBegin = &m_data[0];
-            auto consumed =
-                static_cast<std::size_t>(std::distance(dataBegin, readIterBeg));
-            auto remDataCount = m_data.size() - consumed;
-            m_garbage.insert(m_garbage.end(), m_data.begin() + consumed, m_data.end());
-            std::advance(readIterBeg, remDataCount);
+            m_garbage.insert(m_garbage.end(), readIterBeg, readIterEnd);
+            readIterBeg = readIterEnd;
             checkGarbageFunc();
         }
         return allMsgs;
     }
 
+    /// @brief Overriding implementation to Protocol::decodeFrameImpl().
+    /// @details Uses separate protocol stack object in order not to affect
+    ///     the state of the one used by read(). Not supported (returns
+    ///     empty pointer) when the frames of the protocol stack can not
+    ///     be decoded on their own, see
+    ///     @b comms::protocol::ProtocolLayerBase::isFrameSelfContained().
+    virtual MessagePtr decodeFrameImpl(const DataInfo& dataInfo) override
+    {
+        if ((!ProtocolStack::isFrameSelfContained()) || dataInfo.m_data.empty()) {
+            return MessagePtr();
+        }
+
+        auto frameData = std::make_shared<DataInfo::DataSeq>(dataInfo.m_data);
+        typename ProtocolMessage::ReadIterator frameBeg = &(*frameData)[0];
+        auto readIter = frameBeg;
+        ProtocolMsgPtr msgPtr;
+        auto es = m_decodeProtStack.read(msgPtr, readIter, frameData->size());
+        auto consumed = static_cast<std::size_t>(std::distance(frameBeg, readIter));
+
+        MessagePtr result;
+        if (es == comms::ErrorStatus::Success) {
+            assert(msgPtr);
+            result = MessagePtr(std::move(msgPtr));
+        }
+        else if (es == comms::ErrorStatus::InvalidMsgData) {
+            result.reset(new InvalidMsg());
+        }
+        else {
+            result = createInvalidMessage(dataInfo.m_data);
+            if (!result) {
+                return result;
+            }
+        }
+
+        setNameToMessageProperties(*result);
+        if ((es == comms::ErrorStatus::Success) || (es == comms::ErrorStatus::InvalidMsgData)) {
+            ReceivedFramePtr frame(
+                new ProtocolReceivedFrame(std::move(frameData), 0U, consumed));
+            setReceivedFrameToMessageProperties(std::move(frame), *result);
+        }
+
+        if (!dataInfo.m_extraProperties.isEmpty()) {
+            setExtraInfoToMessageProperties(dataInfo.m_extraProperties, *result);
+            setExtraInfoMsgToMessageProperties(createExtraInfoMsg(dataInfo.m_extraProperties), *result);
+        }
+
+        return result;
+    }
+
     /// @brief Overriding implementation to Protocol::writeImpl().
     virtual DataInfoPtr writeImpl(Message& msg) override
     {
@@ -490,6 +562,49 @@ private:
     static_assert(std::is_same<MsgIdTypeTag, NumericIdTag>::value,
         "Non-numeric IDs are not supported properly yet.");
 
+    static MessagePtr createExtraInfoMsg(const QVariantMap& props)
+    {
+        auto jsonObj = QJsonObject::fromVariantMap(props);
+        QJsonDocument doc(jsonObj);
+
+        std::unique_ptr<ExtraInfoMsg> extraInfoMsgPtr(new ExtraInfoMsg());
+        auto& str = std::get<0>(extraInfoMsgPtr->fields());
+        str.value() = doc.toJson().constData();
+        return MessagePtr(extraInfoMsgPtr.release());
+    }
+
+    class ProtocolReceivedFrame : public ReceivedFrame
+    {
+    public:
+        ProtocolReceivedFrame(DataSeqPtr data, std::size_t offset, std::size_t length)
+          : ReceivedFrame(std::move(data), offset, length)
+        {
+        }
+
+    protected:
+        virtual MessagePtr createTransportMsgImpl() const override
+        {
+            return createFromData<TransportMsg>();
+        }
+
+        virtual MessagePtr createRawDataMsgImpl() const override
+        {
+            return createFromData<RawDataMsg>();
+        }
+
+    private:
+        template <typename TMsg>
+        MessagePtr createFromData() const
+        {
+            std::unique_ptr<TMsg> msgPtr(new TMsg());
+            typename ProtocolMessage::ReadIterator readIter = data();
+            auto es = msgPtr->read(readIter, size());
+            static_cast<void>(es);
+            assert(es == comms::ErrorStatus::Success);
+            return MessagePtr(msgPtr.release());
+        }
+    };
+
     class AllMsgsCreateHelper
     {
     public:
@@ -545,6 +660,18 @@ private:
         unsigned m_currIdx = 0;
     };
 
+    void appendPendingData(const DataInfo::DataSeq& data)
+    {
+        // Drop the consumed prefix only when the new data doesn't fit,
+        // otherwise keep appending after the unconsumed bytes.
+        if ((0U < m_dataOffset) && ((m_data.capacity() - m_data.size()) < data.size())) {
+            m_data.erase(m_data.begin(), m_data.begin() + static_cast<std::ptrdiff_t>(m_dataOffset));
+            m_dataOffset = 0U;
+        }
+
+        m_data.insert(m_data.end(), data.begin(), data.end());
+    }
+
     MessagePtr createMessageInternal(const QString& idAsString, unsigned idx, NumericIdTag)
     {
         MessagePtr result;
@@ -574,7 +701,9 @@ private:
     }
 
     ProtocolStack m_protStack;
+    ProtocolStack m_decodeProtStack;
     std::vector<std::uint8_t> m_data;
+    std::size_t m_dataOffset = 0U;
     std::vector<std::uint8_t> m_garbage;
 };
 
@@ -0,0 +1,100 @@
+//
+// Copyright 2014 - 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QMetaType>
+CC_ENABLE_WARNINGS()
+
+#include "Api.h"
+#include "Message.h"
+
+namespace comms_champion
+{
+
+/// @brief Raw bytes of the received frame with lazily created
+///     "transport" and "raw data" messages.
+/// @details Attached to the received message object as a property by
+///     the @ref Protocol implementation instead of eagerly creating
+///     both the messages for every received frame. The bytes are
+///     referenced as a slice of the data shared by all the frames
+///     received in the same chunk.
+///     The messages are created on the first request and cached for
+///     the subsequent ones.
+/// @headerfile comms_champion/ReceivedFrame.h
+class CC_API ReceivedFrame
+{
+public:
+    /// @brief Type of raw data sequence
+    using DataSeq = Message::DataSeq;
+
+    /// @brief Pointer to shared data buffer
+    using DataSeqPtr = std::shared_ptr<const DataSeq>;
+
+    /// @brief Constructor
+    /// @param[in] data Shared data buffer
+    /// @param[in] offset Offset of the frame within the data buffer
+    /// @param[in] length Number of bytes of the frame.
+    ReceivedFrame(DataSeqPtr data, std::size_t offset, std::size_t length);
+
+    /// @brief Destructor
+    virtual ~ReceivedFrame() noexcept;
+
+    /// @brief Pointer to the first byte of the frame.
+    const std::uint8_t* data() const;
+
+    /// @brief Number of bytes in the frame.
+    std::size_t size() const;
+
+    /// @brief Get "transport" message, create if not created yet.
+    /// @details Invokes createTransportMsgImpl() on the first call.
+    MessagePtr transportMsg() const;
+
+    /// @brief Get "raw data" message, create if not created yet.
+    /// @details Invokes createRawDataMsgImpl() on the first call.
+    MessagePtr rawDataMsg() const;
+
+protected:
+    /// @brief Polymorphic creation of the "transport" message.
+    virtual MessagePtr createTransportMsgImpl() const = 0;
+
+    /// @brief Polymorphic creation of the "raw data" message.
+    virtual MessagePtr createRawDataMsgImpl() const = 0;
+
+private:
+    DataSeqPtr m_data;
+    std::size_t m_offset = 0U;
+    std::size_t m_length = 0U;
+    mutable MessagePtr m_transportMsg;
+    mutable MessagePtr m_rawDataMsg;
+};
+
+/// @brief Pointer to @ref ReceivedFrame
+using ReceivedFramePtr = std::shared_ptr<ReceivedFrame>;
+
+}  // namespace comms_champion
+
+Q_DECLARE_METATYPE(comms_champion::ReceivedFramePtr);
@@ -30,6 +30,7 @@ CC_ENABLE_WARNINGS()
 
 #include "comms_champion/Api.h"
 #include "comms_champion/Message.h"
+#include "comms_champion/ReceivedFrame.h"
 
 namespace comms_champion
 {
@@ -99,9 +100,64 @@ private:
     const QByteArray& m_propName;
 };
 
-class CC_API Type : public PropBase<unsigned>
+/// @brief Base class of the well known properties.
+/// @details Stores the value in the @ref Message::Metadata of the message
+///     object instead of its dynamic properties. Other objects, as well
+///     as the @b QVariantMap, are still handled by the @ref PropBase.
+/// @tparam TValue Type of the value.
+/// @tparam TMember Pointer to the storage member in @ref Message::Metadata
+/// @tparam TSlot Index of the presence bit (see @ref Message::Metadata::Slot)
+template <typename TValue, TValue Message::Metadata::* TMember, unsigned TSlot>
+class MetaPropBase : public PropBase<TValue>
 {
-    typedef PropBase<unsigned> Base;
+    typedef PropBase<TValue> Base;
+public:
+    typedef TValue ValueType;
+
+    MetaPropBase(const QString& name, const QByteArray& propName)
+      : Base(name, propName)
+    {
+    }
+
+    using Base::setTo;
+    using Base::getFrom;
+    using Base::copyFromTo;
+
+    template <typename U>
+    void setTo(U&& val, Message& msg) const
+    {
+        auto& meta = msg.metadata();
+        meta.*TMember = std::forward<U>(val);
+        meta.m_presence |= Mask;
+    }
+
+    ValueType getFrom(const Message& msg, const ValueType& defaultVal = ValueType()) const
+    {
+        auto& meta = msg.metadata();
+        if ((meta.m_presence & Mask) == 0U) {
+            return defaultVal;
+        }
+
+        return meta.*TMember;
+    }
+
+    void copyFromTo(const Message& from, Message& to) const
+    {
+        auto& fromMeta = from.metadata();
+        if ((fromMeta.m_presence & Mask) != 0U) {
+            setTo(fromMeta.*TMember, to);
+        }
+    }
+
+private:
+    static_assert(TSlot < Message::Metadata::Slot_NumOfValues, "Invalid slot");
+    static const std::uint32_t Mask = static_cast<std::uint32_t>(1U) << TSlot;
+};
+
+class CC_API Type : public
+    MetaPropBase<unsigned, &Message::Metadata::m_type, Message::Metadata::Slot_Type>
+{
+    typedef MetaPropBase<unsigned, &Message::Metadata::m_type, Message::Metadata::Slot_Type> Base;
 public:
     typedef Message::Type ValueType;
 
@@ -124,9 +180,10 @@ private:
     static const QByteArray PropName;
 };
 
-class CC_API Timestamp : public PropBase<unsigned long long>
+class CC_API Timestamp : public
+    MetaPropBase<unsigned long long, &Message::Metadata::m_timestamp, Message::Metadata::Slot_Timestamp>
 {
-    typedef PropBase<unsigned long long> Base;
+    typedef MetaPropBase<unsigned long long, &Message::Metadata::m_timestamp, Message::Metadata::Slot_Timestamp> Base;
 public:
     Timestamp() : Base(Name, PropName) {}
 
@@ -135,9 +192,10 @@ private:
     static const QByteArray PropName;
 };
 
-class CC_API ProtocolName : public PropBase<QString>
+class CC_API ProtocolName : public
+    MetaPropBase<QString, &Message::Metadata::m_protocolName, Message::Metadata::Slot_ProtocolName>
 {
-    typedef PropBase<QString> Base;
+    typedef MetaPropBase<QString, &Message::Metadata::m_protocolName, Message::Metadata::Slot_ProtocolName> Base;
 public:
     ProtocolName() : Base(Name, PropName) {}
 
@@ -146,31 +204,58 @@ private:
     static const QByteArray PropName;
 };
 
-class CC_API TransportMsg : public PropBase<MessagePtr>
+class CC_API TransportMsg : public
+    MetaPropBase<MessagePtr, &Message::Metadata::m_transportMsg, Message::Metadata::Slot_TransportMsg>
 {
-    typedef PropBase<MessagePtr> Base;
+    typedef MetaPropBase<MessagePtr, &Message::Metadata::m_transportMsg, Message::Metadata::Slot_TransportMsg> Base;
 public:
     TransportMsg() : Base(Name, PropName) {}
 
+    using Base::getFrom;
+
+    /// @details Falls back to creating the message from the
+    ///     @ref ReceivedFrame property if not assigned explicitly.
+    ValueType getFrom(const Message& msg, const ValueType& defaultVal = ValueType()) const;
+
 private:
     static const QString Name;
     static const QByteArray PropName;
 };
 
-class CC_API RawDataMsg : public PropBase<MessagePtr>
+class CC_API RawDataMsg : public
+    MetaPropBase<MessagePtr, &Message::Metadata::m_rawDataMsg, Message::Metadata::Slot_RawDataMsg>
 {
-    typedef PropBase<MessagePtr> Base;
+    typedef MetaPropBase<MessagePtr, &Message::Metadata::m_rawDataMsg, Message::Metadata::Slot_RawDataMsg> Base;
 public:
     RawDataMsg() : Base(Name, PropName) {}
 
+    using Base::getFrom;
+
+    /// @details Falls back to creating the message from the
+    ///     @ref ReceivedFrame property if not assigned explicitly.
+    ValueType getFrom(const Message& msg, const ValueType& defaultVal = ValueType()) const;
+
+private:
+    static const QString Name;
+    static const QByteArray PropName;
+};
+
+class CC_API ReceivedFrame : public
+    MetaPropBase<ReceivedFramePtr, &Message::Metadata::m_receivedFrame, Message::Metadata::Slot_ReceivedFrame>
+{
+    typedef MetaPropBase<ReceivedFramePtr, &Message::Metadata::m_receivedFrame, Message::Metadata::Slot_ReceivedFrame> Base;
+public:
+    ReceivedFrame() : Base(Name, PropName) {}
+
 private:
     static const QString Name;
     static const QByteArray PropName;
 };
 
-class CC_API ExtraInfoMsg : public PropBase<MessagePtr>
+class CC_API ExtraInfoMsg : public
+    MetaPropBase<MessagePtr, &Message::Metadata::m_extraInfoMsg, Message::Metadata::Slot_ExtraInfoMsg>
 {
-    typedef PropBase<MessagePtr> Base;
+    typedef MetaPropBase<MessagePtr, &Message::Metadata::m_extraInfoMsg, Message::Metadata::Slot_ExtraInfoMsg> Base;
 public:
     ExtraInfoMsg() : Base(Name, PropName) {}
 
@@ -179,9 +264,10 @@ private:
     static const QByteArray PropName;
 };
 
-class CC_API ExtraInfo : public PropBase<QVariantMap>
+class CC_API ExtraInfo : public
+    MetaPropBase<QVariantMap, &Message::Metadata::m_extraInfo, Message::Metadata::Slot_ExtraInfo>
 {
-    typedef PropBase<QVariantMap> Base;
+    typedef MetaPropBase<QVariantMap, &Message::Metadata::m_extraInfo, Message::Metadata::Slot_ExtraInfo> Base;
 public:
     ExtraInfo() : Base(Name, PropName) {}
 
@@ -190,9 +276,10 @@ private:
     static const QByteArray PropName;
 };
 
-class CC_API ForceExtraInfoExistence : public PropBase<bool>
+class CC_API ForceExtraInfoExistence : public
+    MetaPropBase<bool, &Message::Metadata::m_forceExtraInfoExistence, Message::Metadata::Slot_ForceExtraInfoExistence>
 {
-    typedef PropBase<bool> Base;
+    typedef MetaPropBase<bool, &Message::Metadata::m_forceExtraInfoExistence, Message::Metadata::Slot_ForceExtraInfoExistence> Base;
 public:
     ForceExtraInfoExistence() : Base(Name, PropName) {}
 
@@ -202,9 +289,10 @@ private:
 };
 
 
-class CC_API Delay : public PropBase<unsigned long long>
+class CC_API Delay : public
+    MetaPropBase<unsigned long long, &Message::Metadata::m_delay, Message::Metadata::Slot_Delay>
 {
-    typedef PropBase<unsigned long long> Base;
+    typedef MetaPropBase<unsigned long long, &Message::Metadata::m_delay, Message::Metadata::Slot_Delay> Base;
 public:
     Delay() : Base(Name, PropName) {}
 
@@ -213,9 +301,10 @@ private:
     static const QByteArray PropName;
 };
 
-class CC_API DelayUnits : public PropBase<QString>
+class CC_API DelayUnits : public
+    MetaPropBase<QString, &Message::Metadata::m_delayUnits, Message::Metadata::Slot_DelayUnits>
 {
-    typedef PropBase<QString> Base;
+    typedef MetaPropBase<QString, &Message::Metadata::m_delayUnits, Message::Metadata::Slot_DelayUnits> Base;
 public:
     DelayUnits() : Base(Name, PropName) {}
 
@@ -225,9 +314,10 @@ private:
 };
 
 
-class CC_API RepeatDuration : public PropBase<unsigned long long>
+class CC_API RepeatDuration : public
+    MetaPropBase<unsigned long long, &Message::Metadata::m_repeatDuration, Message::Metadata::Slot_RepeatDuration>
 {
-    typedef PropBase<unsigned long long> Base;
+    typedef MetaPropBase<unsigned long long, &Message::Metadata::m_repeatDuration, Message::Metadata::Slot_RepeatDuration> Base;
 public:
     RepeatDuration() : Base(Name, PropName) {}
 
@@ -236,9 +326,10 @@ private:
     static const QByteArray PropName;
 };
 
-class CC_API RepeatDurationUnits : public PropBase<QString>
+class CC_API RepeatDurationUnits : public
+    MetaPropBase<QString, &Message::Metadata::m_repeatDurationUnits, Message::Metadata::Slot_RepeatDurationUnits>
 {
-    typedef PropBase<QString> Base;
+    typedef MetaPropBase<QString, &Message::Metadata::m_repeatDurationUnits, Message::Metadata::Slot_RepeatDurationUnits> Base;
 public:
     RepeatDurationUnits() : Base(Name, PropName) {}
 
@@ -247,9 +338,10 @@ private:
     static const QByteArray PropName;
 };
 
-class CC_API RepeatCount : public PropBase<unsigned>
+class CC_API RepeatCount : public
+    MetaPropBase<unsigned, &Message::Metadata::m_repeatCount, Message::Metadata::Slot_RepeatCount>
 {
-    typedef PropBase<unsigned> Base;
+    typedef MetaPropBase<unsigned, &Message::Metadata::m_repeatCount, Message::Metadata::Slot_RepeatCount> Base;
 public:
     RepeatCount() : Base(Name, PropName) {}
 
@@ -258,9 +350,10 @@ private:
     static const QByteArray PropName;
 };
 
-class CC_API ScrollPos : public PropBase<int>
+class CC_API ScrollPos : public
+    MetaPropBase<int, &Message::Metadata::m_scrollPos, Message::Metadata::Slot_ScrollPos>
 {
-    typedef PropBase<int> Base;
+    typedef MetaPropBase<int, &Message::Metadata::m_scrollPos, Message::Metadata::Slot_ScrollPos> Base;
 public:
     ScrollPos() : Base(Name, PropName) {}
 
@@ -270,9 +363,10 @@ private:
 
 };
 
-class CC_API Comment : public PropBase<QString>
+class CC_API Comment : public
+    MetaPropBase<QString, &Message::Metadata::m_comment, Message::Metadata::Slot_Comment>
 {
-    typedef PropBase<QString> Base;
+    typedef MetaPropBase<QString, &Message::Metadata::m_comment, Message::Metadata::Slot_Comment> Base;
 public:
     Comment() : Base(Name, PropName) {}
 
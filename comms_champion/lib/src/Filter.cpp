@@ -17,6 +17,8 @@
 
 #include "comms_champion/Filter.h"
 
+#include <cassert>
+
 namespace comms_champion
 {
 
@@ -43,6 +45,27 @@ QList<DataInfoPtr> Filter::sendData(DataInfoPtr dataPtr)
     return sendDataImpl(std::move(dataPtr));
 }
 
+bool Filter::supportsDataSpan() const
+{
+    return supportsDataSpanImpl();
+}
+
+bool Filter::recvDataSpan(
+    DataSpan& data,
+    DataInfo::DataSeq& outBuf,
+    DataInfo::PropertiesMap& props)
+{
+    return recvDataSpanImpl(data, outBuf, props);
+}
+
+bool Filter::sendDataSpan(
+    DataSpan& data,
+    DataInfo::DataSeq& outBuf,
+    DataInfo::PropertiesMap& props)
+{
+    return sendDataSpanImpl(data, outBuf, props);
+}
+
 bool Filter::startImpl()
 {
     return true;
@@ -52,6 +75,35 @@ void Filter::stopImpl()
 {
 }
 
+bool Filter::supportsDataSpanImpl() const
+{
+    return false;
+}
+
+bool Filter::recvDataSpanImpl(
+    DataSpan& data,
+    DataInfo::DataSeq& outBuf,
+    DataInfo::PropertiesMap& props)
+{
+    static_cast<void>(data);
+    static_cast<void>(outBuf);
+    static_cast<void>(props);
+    assert(!"Span based processing is not supported");
+    return false;
+}
+
+bool Filter::sendDataSpanImpl(
+    DataSpan& data,
+    DataInfo::DataSeq& outBuf,
+    DataInfo::PropertiesMap& props)
+{
+    static_cast<void>(data);
+    static_cast<void>(outBuf);
+    static_cast<void>(props);
+    assert(!"Span based processing is not supported");
+    return false;
+}
+
 void Filter::reportDataToSend(DataInfoPtr dataPtr)
 {
     if (m_dataToSendCallback) {
@@ -70,16 +70,53 @@ void MsgMgr::deleteAllMsgs()
     m_impl->deleteAllMsgs();
 }
 
+void MsgMgr::updateMsg(MessagePtr msg)
+{
+    m_impl->updateMsg(std::move(msg));
+}
+
 void MsgMgr::sendMsgs(MessagesList&& msgs)
 {
     m_impl->sendMsgs(std::move(msgs));
 }
 
-const MsgMgr::AllMessages& MsgMgr::getAllMsgs() const
+std::size_t MsgMgr::getMsgsCount() const
+{
+    return m_impl->getMsgsCount();
+}
+
+MessagePtr MsgMgr::getMsg(std::size_t idx) const
+{
+    return m_impl->getMsg(idx);
+}
+
+MsgMgr::AllMessages MsgMgr::getAllMsgs() const
 {
     return m_impl->getAllMsgs();
 }
 
+void MsgMgr::getAllMsgs(AllMessages& msgs) const
+{
+    m_impl->getAllMsgs(msgs);
+}
+
+const MsgMgr::MsgsPositions& MsgMgr::getMsgsOfType(MsgType type) const
+{
+    return m_impl->getMsgsOfType(type);
+}
+
+const MsgMgr::MsgsPositions& MsgMgr::getMsgsWithId(const QString& id) const
+{
+    return m_impl->getMsgsWithId(id);
+}
+
+MsgMgr::MsgsPositions MsgMgr::getMsgsInTimeRange(
+    TimestampType from,
+    TimestampType to) const
+{
+    return m_impl->getMsgsInTimeRange(from, to);
+}
+
 void MsgMgr::addMsgs(const MessagesList& msgs, bool reportAdded)
 {
     m_impl->addMsgs(msgs, reportAdded);
@@ -95,6 +132,11 @@ void MsgMgr::setProtocol(ProtocolPtr protocol)
     m_impl->setProtocol(std::move(protocol));
 }
 
+void MsgMgr::setDecodeProtocol(ProtocolPtr protocol)
+{
+    m_impl->setDecodeProtocol(std::move(protocol));
+}
+
 void MsgMgr::addFilter(FilterPtr filter)
 {
     m_impl->addFilter(std::move(filter));
@@ -105,6 +147,16 @@ void MsgMgr::setMsgAddedCallbackFunc(MsgAddedCallbackFunc&& func)
     m_impl->setMsgAddedCallbackFunc(std::move(func));
 }
 
+void MsgMgr::setMsgsAddedCallbackFunc(MsgsAddedCallbackFunc&& func)
+{
+    m_impl->setMsgsAddedCallbackFunc(std::move(func));
+}
+
+void MsgMgr::setMsgsAddedCoalescing(unsigned maxDelayMs, std::size_t maxCount)
+{
+    m_impl->setMsgsAddedCoalescing(maxDelayMs, maxCount);
+}
+
 void MsgMgr::setErrorReportCallbackFunc(ErrorReportCallbackFunc&& func)
 {
     m_impl->setErrorReportCallbackFunc(std::move(func));
@@ -37,20 +37,6 @@ namespace comms_champion
 namespace
 {
 
-class SeqNumber : public property::message::PropBase<unsigned long long>
-{
-    typedef property::message::PropBase<unsigned long long> Base;
-public:
-    SeqNumber() : Base(Name, PropName) {};
-
-private:
-    static const QString Name;
-    static const QByteArray PropName;
-};
-
-const QString SeqNumber::Name("cc.msg_num");
-const QByteArray SeqNumber::PropName = SeqNumber::Name.toUtf8();
-
 void updateMsgTimestamp(Message& msg, const DataInfo::Timestamp& timestamp)
 {
     auto sinceEpoch = timestamp.time_since_epoch();
@@ -59,11 +45,97 @@ void updateMsgTimestamp(Message& msg, const DataInfo::Timestamp& timestamp)
     property::message::Timestamp().setTo(milliseconds.count(), msg);
 }
 
+typedef QList<DataInfoPtr> DataInfosList;
+typedef bool (Filter::*FilterSpanFunc)(
+    Filter::DataSpan&,
+    DataInfo::DataSeq&,
+    DataInfo::PropertiesMap&);
+typedef DataInfosList (Filter::*FilterListFunc)(DataInfoPtr);
+
+void assignFilterSpan(
+    DataInfo::DataSeq& data,
+    const Filter::DataSpan& span,
+    DataInfo::DataSeq& buf)
+{
+    if (span.m_size == 0U) {
+        data.clear();
+        return;
+    }
+
+    auto* spanEnd = span.m_data + span.m_size;
+    if ((!buf.empty()) &&
+        (buf.data() <= span.m_data) &&
+        (spanEnd <= (buf.data() + buf.size()))) {
+        auto offset = std::distance(buf.data(), span.m_data);
+        buf.erase(buf.begin() + offset + static_cast<std::ptrdiff_t>(span.m_size), buf.end());
+        buf.erase(buf.begin(), buf.begin() + offset);
+        data.swap(buf); // The buffer keeps previous storage for reuse
+        return;
+    }
+
+    assert(data.data() <= span.m_data);
+    assert(spanEnd <= (data.data() + data.size()));
+    auto offset = std::distance(data.data(), span.m_data);
+    data.erase(data.begin() + offset + static_cast<std::ptrdiff_t>(span.m_size), data.end());
+    data.erase(data.begin(), data.begin() + offset);
+}
+
+template <typename TIter>
+void applyFilters(
+    TIter first,
+    TIter last,
+    DataInfosList& data,
+    DataInfo::DataSeq& buf,
+    FilterSpanFunc spanFunc,
+    FilterListFunc listFunc)
+{
+    for (auto iter = first; iter != last; ++iter) {
+        if (data.isEmpty()) {
+            return;
+        }
+
+        auto& filter = **iter;
+        if (filter.supportsDataSpan()) {
+            auto dataIter = data.begin();
+            while (dataIter != data.end()) {
+                auto& info = **dataIter;
+                Filter::DataSpan span{info.m_data.data(), info.m_data.size()};
+                buf.clear();
+                if (!(filter.*spanFunc)(span, buf, info.m_extraProperties)) {
+                    dataIter = data.erase(dataIter);
+                    continue;
+                }
+
+                assignFilterSpan(info.m_data, span, buf);
+                ++dataIter;
+            }
+            continue;
+        }
+
+        DataInfosList dataTmp;
+        for (auto& d : data) {
+            dataTmp.append((filter.*listFunc)(d));
+        }
+
+        data.swap(dataTmp);
+    }
+}
+
 }  // namespace
 
 MsgMgrImpl::MsgMgrImpl()
 {
+    static const int DefaultMsgsAddedDelay = 100;
+
     m_allMsgs.reserve(1024);
+    m_msgsAddedTimer.setSingleShot(true);
+    m_msgsAddedTimer.setInterval(DefaultMsgsAddedDelay);
+    QObject::connect(
+        &m_msgsAddedTimer, &QTimer::timeout,
+        [this]()
+        {
+            reportPendingMsgsAdded();
+        });
 }
 
 MsgMgrImpl::~MsgMgrImpl() noexcept = default;
@@ -83,6 +155,23 @@ void MsgMgrImpl::start()
         f->start();
     }
 
+    if (m_decodeProtocol) {
+        m_pipeline.reset(new MsgPipeline());
+        m_pipeline->setDecodeFunc(
+            [this](DataInfoPtr dataInfoPtr) -> MessagesList
+            {
+                return decodeData(std::move(dataInfoPtr), *m_decodeProtocol);
+            });
+
+        m_pipeline->setMsgsDecodedCallbackFunc(
+            [this](MessagesList&& msgs)
+            {
+                msgsReceived(std::move(msgs));
+            });
+
+        m_pipeline->start();
+    }
+
     m_running = true;
 }
 
@@ -93,14 +182,21 @@ void MsgMgrImpl::stop()
         return;
     }
 
-    for (auto& f : m_filters) {
-        f->stop();
-    }
-
     if (m_socket) {
         m_socket->stop();
     }
 
+    if (m_pipeline) {
+        m_pipeline->stop();
+        m_pipeline.reset();
+    }
+
+    reportPendingMsgsAdded();
+
+    for (auto& f : m_filters) {
+        f->stop();
+    }
+
     m_running = false;
 }
 
@@ -113,6 +209,7 @@ void MsgMgrImpl::clear()
 
     m_socket.reset();
     m_protocol.reset();
+    m_decodeProtocol.reset();
     m_filters.clear();
 }
 
@@ -136,24 +233,19 @@ void MsgMgrImpl::deleteMsg(MessagePtr msg)
     assert(!m_allMsgs.empty());
     assert(msg);
 
-    auto msgNum = SeqNumber().getFrom(*msg);
-
-    auto iter = std::lower_bound(
-        m_allMsgs.begin(),
-        m_allMsgs.end(),
-        msgNum,
-        [](const MessagePtr& msgTmp, MsgNumberType val) -> bool
-        {
-            return SeqNumber().getFrom(*msgTmp) < val;
-        });
-
-    if (iter == m_allMsgs.end()) {
+    if (!m_allMsgs.erase(*msg)) {
         assert(!"Deleting non existing message.");
         return;
     }
 
-    assert(msg.get() == iter->get()); // Make sure that the right message is found
-    m_allMsgs.erase(iter);
+    m_pendingAddedMsgs.remove(msg);
+}
+
+void MsgMgrImpl::updateMsg(MessagePtr msg)
+{
+    assert(msg);
+    // Messages not recorded (such as ones in the send list) are ignored
+    m_allMsgs.update(msg);
 }
 
 void MsgMgrImpl::sendMsgs(MessagesList&& msgs)
@@ -175,8 +267,7 @@ void MsgMgrImpl::sendMsgs(MessagesList&& msgs)
                     property::message::Type().setTo(MsgType::Sent, *msgPtr);
                     auto now = DataInfo::TimestampClock::now();
                     updateMsgTimestamp(*msgPtr, now);
-                    m_allMsgs.push_back(msgPtr);
-                    reportMsgAdded(msgPtr);
+                    msgAdded(msgPtr);
                 });
 
         auto dataInfoPtr = m_protocol->write(*msgPtr);
@@ -184,20 +275,16 @@ void MsgMgrImpl::sendMsgs(MessagesList&& msgs)
             continue;
         }
 
-        QList <DataInfoPtr> data;
+        DataInfosList data;
         data.append(std::move(dataInfoPtr));
-        for (auto& filter : m_filters) {
-            if (data.isEmpty()) {
-                break;
-            }
-
-            QList <DataInfoPtr> dataTmp;
-            for (auto& d : data) {
-                dataTmp.append(filter->sendData(d));
-            }
-
-            data.swap(dataTmp);
-        }
+        std::unique_lock<std::recursive_mutex> filtersGuard(m_filtersLock);
+        DataInfo::DataSeq buf;
+        buf.swap(m_sendFilterBuf); // Filters may re-enter with their own data
+        applyFilters(
+            m_filters.begin(), m_filters.end(), data, buf,
+            &Filter::sendDataSpan, &Filter::sendData);
+        m_sendFilterBuf.swap(buf);
+        filtersGuard.unlock();
 
         if (data.isEmpty()) {
             continue;
@@ -240,9 +327,11 @@ void MsgMgrImpl::addMsgs(const MessagesList& msgs, bool reportAdded)
 
         updateInternalId(*m);
         if (reportAdded) {
-            reportMsgAdded(m);
+            msgAdded(m);
+            continue;
         }
-        m_allMsgs.push_back(m);
+
+        m_allMsgs.add(m);
     }
 }
 
@@ -276,9 +365,16 @@ void MsgMgrImpl::setSocket(SocketPtr socket)
 
 void MsgMgrImpl::setProtocol(ProtocolPtr protocol)
 {
+    m_allMsgs.setProtocol(protocol);
     m_protocol = std::move(protocol);
 }
 
+void MsgMgrImpl::setDecodeProtocol(ProtocolPtr protocol)
+{
+    assert(!m_running);
+    m_decodeProtocol = std::move(protocol);
+}
+
 void MsgMgrImpl::addFilter(FilterPtr filter)
 {
     if (!filter) {
@@ -296,37 +392,43 @@ void MsgMgrImpl::addFilter(FilterPtr filter)
             assert(filterIdx < m_filters.size());
             auto revIdx = m_filters.size() - filterIdx;
 
-            QList<DataInfoPtr> data;
+            DataInfosList data;
             data.append(std::move(dataPtr));
-            for (auto iter = m_filters.rbegin() + revIdx; iter != m_filters.rend(); ++iter) {
-
-                if (!data.isEmpty()) {
-                    break;
-                }
-
-                auto nextFilter = *iter;
+            std::unique_lock<std::recursive_mutex> filtersGuard(m_filtersLock);
+            DataInfo::DataSeq buf;
+            buf.swap(m_sendFilterBuf); // Filters may re-enter with their own data
+            applyFilters(
+                m_filters.rbegin() + static_cast<std::ptrdiff_t>(revIdx), m_filters.rend(), data, buf,
+                &Filter::sendDataSpan, &Filter::sendData);
+            m_sendFilterBuf.swap(buf);
+            filtersGuard.unlock();
 
-                QList<DataInfoPtr> dataTmp;
-                for (auto& d : data) {
-                    dataTmp.append(nextFilter->sendData(d));
-                }
-
-                data.swap(dataTmp);
-            }
-
-            if (!m_socket) {
+            if (data.isEmpty()) {
                 return;
             }
 
-            for (auto& d : data) {
-                m_socket->sendData(std::move(d));
-            }
+            // May be invoked on the filter's own thread
+            invokeInOwnerThread(
+                [this, data]()
+                {
+                    if (!m_socket) {
+                        return;
+                    }
+
+                    for (auto& d : data) {
+                        m_socket->sendData(d);
+                    }
+                });
         });
 
     filter->setErrorReportCallback(
         [this](const QString& msg)
         {
-            reportError(msg);
+            invokeInOwnerThread(
+                [this, msg]()
+                {
+                    reportError(msg);
+                });
         });
 
     m_filters.push_back(std::move(filter));
@@ -338,68 +440,121 @@ void MsgMgrImpl::socketDataReceived(DataInfoPtr dataInfoPtr)
         return;
     }
 
-    QList<DataInfoPtr> data;
-    data.append(std::move(dataInfoPtr));
-    for (auto filt : m_filters) {
-        assert(filt);
-
-        if (data.isEmpty()) {
-            return;
-        }
+    auto timestamp = dataInfoPtr->m_timestamp;
+    static const DataInfo::Timestamp DefaultTimestamp;
+    if (timestamp == DefaultTimestamp) {
+        timestamp = DataInfo::TimestampClock::now();
+    }
 
-        QList<DataInfoPtr> dataTmp;
+    // The filters are always invoked on the thread MsgMgr belongs to,
+    // only the protocol read may be done by the decode pipeline.
+    DataInfosList data;
+    data.append(std::move(dataInfoPtr));
+    std::unique_lock<std::recursive_mutex> filtersGuard(m_filtersLock);
+    DataInfo::DataSeq buf;
+    buf.swap(m_recvFilterBuf);
+    applyFilters(
+        m_filters.begin(), m_filters.end(), data, buf,
+        &Filter::recvDataSpan, &Filter::recvData);
+    m_recvFilterBuf.swap(buf);
+    filtersGuard.unlock();
+
+    if (m_pipeline) {
         for (auto& d : data) {
-            dataTmp.append(filt->recvData(d));
+            d->m_timestamp = timestamp;
+            m_pipeline->pushData(std::move(d));
         }
-
-        data.swap(dataTmp);
-    }
-
-    if (data.isEmpty()) {
         return;
     }
 
     MessagesList msgsList;
-    while (!data.isEmpty()) {
-        auto nextDataPtr = data.front();
-        data.pop_front();
-
-        auto msgs = m_protocol->read(*nextDataPtr);
+    for (auto& d : data) {
+        d->m_timestamp = timestamp;
+        auto msgs = decodeData(std::move(d), *m_protocol);
         msgsList.insert(msgsList.end(), msgs.begin(), msgs.end());
     }
 
-    if (msgsList.empty()) {
-        return;
-    }
+    msgsReceived(std::move(msgsList));
+}
 
+MsgMgrImpl::MessagesList MsgMgrImpl::decodeData(
+    DataInfoPtr dataInfoPtr,
+    Protocol& protocol)
+{
+    auto msgsList = protocol.read(*dataInfoPtr);
     for (auto& m : msgsList) {
         assert(m);
-        updateInternalId(*m);
         property::message::Type().setTo(MsgType::Received, *m);
+        updateMsgTimestamp(*m, dataInfoPtr->m_timestamp);
+    }
 
-        static const DataInfo::Timestamp DefaultTimestamp;
-        if (dataInfoPtr->m_timestamp != DefaultTimestamp) {
-            updateMsgTimestamp(*m, dataInfoPtr->m_timestamp);
-        }
-        else {
-            auto now = DataInfo::TimestampClock::now();
-            updateMsgTimestamp(*m, now);
-        }
+    return msgsList;
+}
 
-        reportMsgAdded(m);
+void MsgMgrImpl::msgsReceived(MessagesList&& msgs)
+{
+    if (msgs.empty()) {
+        return;
     }
 
-    m_allMsgs.reserve(m_allMsgs.size() + msgsList.size());
-    std::move(msgsList.begin(), msgsList.end(), std::back_inserter(m_allMsgs));
+    m_allMsgs.reserve(m_allMsgs.size() + msgs.size());
+    for (auto& m : msgs) {
+        assert(m);
+        updateInternalId(*m);
+        msgAdded(std::move(m));
+    }
 }
 
 void MsgMgrImpl::updateInternalId(Message& msg)
 {
-    SeqNumber().setTo(m_nextMsgNum, msg);
+    MsgStore::setSeqNumber(m_nextMsgNum, msg);
     ++m_nextMsgNum;
     assert(0 < m_nextMsgNum); // wrap around is not supported
 }
 
+void MsgMgrImpl::setMsgsAddedCoalescing(unsigned maxDelayMs, std::size_t maxCount)
+{
+    m_msgsAddedTimer.setInterval(static_cast<int>(maxDelayMs));
+    m_msgsAddedMaxCount = std::max(maxCount, static_cast<std::size_t>(1U));
+}
+
+void MsgMgrImpl::msgAdded(MessagePtr msg)
+{
+    // The message is stored right away, only the notification is delayed
+    m_allMsgs.add(msg);
+    if (!m_msgsAddedCallback) {
+        reportMsgAdded(std::move(msg));
+        return;
+    }
+
+    m_pendingAddedMsgs.push_back(std::move(msg));
+    if (m_msgsAddedMaxCount <= m_pendingAddedMsgs.size()) {
+        reportPendingMsgsAdded();
+        return;
+    }
+
+    if (!m_msgsAddedTimer.isActive()) {
+        m_msgsAddedTimer.start();
+    }
+}
+
+void MsgMgrImpl::reportPendingMsgsAdded()
+{
+    m_msgsAddedTimer.stop();
+    if (m_pendingAddedMsgs.empty()) {
+        return;
+    }
+
+    MessagesList msgs;
+    msgs.swap(m_pendingAddedMsgs);
+    for (auto& m : msgs) {
+        reportMsgAdded(m);
+    }
+
+    assert(m_msgsAddedCallback);
+    m_msgsAddedCallback(msgs);
+}
+
 void MsgMgrImpl::reportMsgAdded(MessagePtr msg)
 {
     if (m_msgAddedCallback) {
@@ -18,9 +18,19 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <vector>
 
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QTimer>
+CC_ENABLE_WARNINGS()
+
 #include "comms_champion/MsgMgr.h"
+#include "MsgStore.h"
+#include "MsgPipeline.h"
 
 namespace comms_champion
 {
@@ -32,6 +42,8 @@ public:
     typedef MsgMgr::MessagesList MessagesList;
 
     typedef MsgMgr::MsgType MsgType;
+    typedef MsgMgr::MsgsPositions MsgsPositions;
+    typedef MsgMgr::TimestampType TimestampType;
 
     MsgMgrImpl();
     ~MsgMgrImpl() noexcept;
@@ -47,23 +59,61 @@ public:
     void deleteMsg(MessagePtr msg);
     void deleteAllMsgs()
     {
+        m_msgsAddedTimer.stop();
+        m_pendingAddedMsgs.clear();
         m_allMsgs.clear();
     }
 
+    void updateMsg(MessagePtr msg);
+
     void sendMsgs(MessagesList&& msgs);
 
-    const AllMessages& getAllMsgs() const
+    std::size_t getMsgsCount() const
+    {
+        return m_allMsgs.size();
+    }
+
+    MessagePtr getMsg(std::size_t idx) const
+    {
+        return m_allMsgs.at(idx);
+    }
+
+    AllMessages getAllMsgs() const
+    {
+        AllMessages allMsgs;
+        getAllMsgs(allMsgs);
+        return allMsgs;
+    }
+
+    void getAllMsgs(AllMessages& msgs) const
+    {
+        m_allMsgs.getAll(msgs);
+    }
+
+    const MsgsPositions& getMsgsOfType(MsgType type) const
+    {
+        return m_allMsgs.positionsOfType(type);
+    }
+
+    const MsgsPositions& getMsgsWithId(const QString& id) const
+    {
+        return m_allMsgs.positionsOfId(id);
+    }
+
+    MsgsPositions getMsgsInTimeRange(TimestampType from, TimestampType to) const
     {
-        return m_allMsgs;
+        return m_allMsgs.positionsInTimeRange(from, to);
     }
 
     void addMsgs(const MessagesList& msgs, bool reportAdded);
 
     void setSocket(SocketPtr socket);
     void setProtocol(ProtocolPtr protocol);
+    void setDecodeProtocol(ProtocolPtr protocol);
     void addFilter(FilterPtr filter);
 
     typedef MsgMgr::MsgAddedCallbackFunc MsgAddedCallbackFunc;
+    typedef MsgMgr::MsgsAddedCallbackFunc MsgsAddedCallbackFunc;
     typedef MsgMgr::ErrorReportCallbackFunc ErrorReportCallbackFunc;
     typedef MsgMgr::SocketDisconnectedReportCallbackFunc SocketDisconnectedReportCallbackFunc;
 
@@ -73,6 +123,14 @@ public:
         m_msgAddedCallback = std::forward<TFunc>(func);
     }
 
+    template <typename TFunc>
+    void setMsgsAddedCallbackFunc(TFunc&& func)
+    {
+        m_msgsAddedCallback = std::forward<TFunc>(func);
+    }
+
+    void setMsgsAddedCoalescing(unsigned maxDelayMs, std::size_t maxCount);
+
     template <typename TFunc>
     void setErrorReportCallbackFunc(TFunc&& func)
     {
@@ -86,25 +144,50 @@ public:
     }
 
 private:
-    typedef unsigned long long MsgNumberType;
+    typedef MsgStore::MsgNumberType MsgNumberType;
     typedef std::vector<FilterPtr> FiltersList;
 
     void socketDataReceived(DataInfoPtr dataInfoPtr);
+    MessagesList decodeData(DataInfoPtr dataInfoPtr, Protocol& protocol);
+    void msgsReceived(MessagesList&& msgs);
+
+    template <typename TFunc>
+    void invokeInOwnerThread(TFunc&& func)
+    {
+        if (m_pipeline) {
+            m_pipeline->invokeInOwnerThread(std::forward<TFunc>(func));
+            return;
+        }
+
+        func();
+    }
     void updateInternalId(Message& msg);
+    void msgAdded(MessagePtr msg);
+    void reportPendingMsgsAdded();
     void reportMsgAdded(MessagePtr msg);
     void reportError(const QString& error);
     void reportSocketDisconnected();
 
-    AllMessages m_allMsgs;
+    MsgStore m_allMsgs;
     bool m_recvEnabled = false;
 
     SocketPtr m_socket;
     ProtocolPtr m_protocol;
+    ProtocolPtr m_decodeProtocol;
     FiltersList m_filters;
+    std::recursive_mutex m_filtersLock;
+    DataInfo::DataSeq m_recvFilterBuf;
+    DataInfo::DataSeq m_sendFilterBuf;
+    std::unique_ptr<MsgPipeline> m_pipeline;
     MsgNumberType m_nextMsgNum = 1;
     bool m_running = false;
 
+    MessagesList m_pendingAddedMsgs;
+    std::size_t m_msgsAddedMaxCount = 1000U;
+    QTimer m_msgsAddedTimer;
+
     MsgAddedCallbackFunc m_msgAddedCallback;
+    MsgsAddedCallbackFunc m_msgsAddedCallback;
     ErrorReportCallbackFunc m_errorReportCallback;
     SocketDisconnectedReportCallbackFunc m_socketDisconnectReportCallback;
 };
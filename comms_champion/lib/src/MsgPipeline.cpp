@@ -0,0 +1,163 @@
+//
+// Copyright 2014 - 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "MsgPipeline.h"
+
+#include <cassert>
+
+namespace comms_champion
+{
+
+namespace
+{
+
+void moveMsgToThread(Message& msg, QThread* thread)
+{
+    if (msg.thread() != thread) {
+        msg.moveToThread(thread);
+    }
+
+    // Access the storage directly, the property getters create the
+    // companion messages of the received frame on demand.
+    auto& meta = msg.metadata();
+    Message* companions[] = {
+        meta.m_transportMsg.get(),
+        meta.m_rawDataMsg.get(),
+        meta.m_extraInfoMsg.get()
+    };
+
+    for (auto* c : companions) {
+        if (c) {
+            moveMsgToThread(*c, thread);
+        }
+    }
+}
+
+}  // namespace
+
+MsgPipeline::MsgPipeline()
+  : m_ownerThread(thread())
+{
+}
+
+MsgPipeline::~MsgPipeline() noexcept
+{
+    if (isRunning()) {
+        stop();
+    }
+}
+
+void MsgPipeline::start()
+{
+    if (isRunning()) {
+        assert(!"Already running");
+        return;
+    }
+
+    assert(m_decodeFunc);
+    m_ownerThread = thread();
+    m_stopRequested = false;
+    m_thread = std::thread(
+        [this]()
+        {
+            decodeLoop();
+        });
+}
+
+void MsgPipeline::stop()
+{
+    if (!isRunning()) {
+        assert(!"Already stopped.");
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_stopRequested = true;
+    }
+    m_cond.notify_one();
+    m_thread.join();
+    m_thread = std::thread();
+
+    reportDecoded();
+}
+
+void MsgPipeline::pushData(DataInfoPtr dataPtr)
+{
+    assert(isRunning());
+    m_input.push(std::move(dataPtr));
+
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_inputPending = true;
+    }
+    m_cond.notify_one();
+}
+
+void MsgPipeline::reportDecoded()
+{
+    m_reportPending.exchange(false, std::memory_order_acq_rel);
+
+    MessagesList msgs;
+    while (m_output.pop(msgs)) {
+        if (m_msgsDecodedCallback) {
+            m_msgsDecodedCallback(std::move(msgs));
+        }
+        msgs.clear();
+    }
+}
+
+void MsgPipeline::decodeLoop()
+{
+    while (true) {
+        DataInfoPtr dataPtr;
+        if (m_input.pop(dataPtr)) {
+            auto msgs = m_decodeFunc(std::move(dataPtr));
+            if (msgs.empty()) {
+                continue;
+            }
+
+            for (auto& m : msgs) {
+                assert(m);
+                moveMsgToThread(*m, m_ownerThread);
+            }
+
+            m_output.push(std::move(msgs));
+            if (!m_reportPending.exchange(true, std::memory_order_acq_rel)) {
+                QMetaObject::invokeMethod(this, "reportDecoded", Qt::QueuedConnection);
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> guard(m_lock);
+        m_cond.wait(
+            guard,
+            [this]()
+            {
+                return m_inputPending || m_stopRequested;
+            });
+
+        if (!m_inputPending) {
+            break;
+        }
+
+        m_inputPending = false;
+    }
+}
+
+}  // namespace comms_champion
@@ -0,0 +1,119 @@
+//
+// Copyright 2014 - 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QMetaObject>
+#include <QtCore/QObject>
+#include <QtCore/QThread>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/DataInfo.h"
+#include "comms_champion/Protocol.h"
+#include "SpscQueue.h"
+
+namespace comms_champion
+{
+
+/// @brief Decodes the received data on the dedicated thread.
+/// @details The data is pushed by the thread the object belongs to, and
+///     processed in the same order by the decode function on the worker
+///     thread. The resulting messages, together with the messages attached
+///     to them as properties, are moved back to the owner thread,
+///     handed over via lock-free queue and reported in batches
+///     (one per pushed data chunk) from the owner's event loop.
+class MsgPipeline : public QObject
+{
+    Q_OBJECT
+public:
+    typedef Protocol::MessagesList MessagesList;
+    typedef std::function<MessagesList (DataInfoPtr)> DecodeFunc;
+    typedef std::function<void (MessagesList&&)> MsgsDecodedCallbackFunc;
+
+    MsgPipeline();
+    ~MsgPipeline() noexcept;
+
+    template <typename TFunc>
+    void setDecodeFunc(TFunc&& func)
+    {
+        m_decodeFunc = std::forward<TFunc>(func);
+    }
+
+    template <typename TFunc>
+    void setMsgsDecodedCallbackFunc(TFunc&& func)
+    {
+        m_msgsDecodedCallback = std::forward<TFunc>(func);
+    }
+
+    void start();
+
+    /// @brief Stop the worker thread.
+    /// @details Decodes all the pushed data and reports decoded
+    ///     messages before returning.
+    void stop();
+
+    bool isRunning() const
+    {
+        return m_thread.joinable();
+    }
+
+    void pushData(DataInfoPtr dataPtr);
+
+    /// @brief Invoke provided function in the thread the object belongs to.
+    /// @details Invoked immediately when called from the same thread,
+    ///     otherwise posted to its event loop.
+    template <typename TFunc>
+    void invokeInOwnerThread(TFunc&& func)
+    {
+        if (QThread::currentThread() == m_ownerThread) {
+            func();
+            return;
+        }
+
+        QMetaObject::invokeMethod(this, std::forward<TFunc>(func), Qt::QueuedConnection);
+    }
+
+private slots:
+    void reportDecoded();
+
+private:
+    void decodeLoop();
+
+    DecodeFunc m_decodeFunc;
+    MsgsDecodedCallbackFunc m_msgsDecodedCallback;
+    QThread* m_ownerThread = nullptr;
+    SpscQueue<DataInfoPtr> m_input;
+    SpscQueue<MessagesList> m_output;
+    std::mutex m_lock;
+    std::condition_variable m_cond;
+    bool m_inputPending = false;
+    bool m_stopRequested = false;
+    std::atomic<bool> m_reportPending{false};
+    std::thread m_thread;
+};
+
+}  // namespace comms_champion
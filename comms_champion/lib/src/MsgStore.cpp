@@ -0,0 +1,632 @@
+//
+// Copyright 2014 - 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "MsgStore.h"
+
+#include <cassert>
+#include <algorithm>
+#include <limits>
+
+#include "comms_champion/DataInfo.h"
+#include "comms_champion/ReceivedFrame.h"
+#include "comms_champion/property/message.h"
+
+namespace comms_champion
+{
+
+namespace
+{
+
+const std::size_t ArenaChunkSize = 1024 * 1024;
+const std::size_t MinLivePurgeLimit = 1024;
+const std::size_t MaxEraseLogSize = 1024;
+
+class SeqNumber : public
+    property::message::MetaPropBase<
+        unsigned long long,
+        &Message::Metadata::m_seqNumber,
+        Message::Metadata::Slot_SeqNumber
+    >
+{
+    typedef property::message::MetaPropBase<
+        unsigned long long,
+        &Message::Metadata::m_seqNumber,
+        Message::Metadata::Slot_SeqNumber
+    > Base;
+public:
+    SeqNumber() : Base(Name, PropName) {};
+
+private:
+    static const QString Name;
+    static const QByteArray PropName;
+};
+
+const QString SeqNumber::Name("cc.msg_num");
+const QByteArray SeqNumber::PropName = SeqNumber::Name.toUtf8();
+
+std::uint32_t slotMask(unsigned slot)
+{
+    return static_cast<std::uint32_t>(1U) << slot;
+}
+
+// Properties that are either kept in the columns or re-created by
+// Protocol::decodeFrame().
+const std::uint32_t ReproducibleMask =
+    slotMask(Message::Metadata::Slot_SeqNumber) |
+    slotMask(Message::Metadata::Slot_Type) |
+    slotMask(Message::Metadata::Slot_Timestamp) |
+    slotMask(Message::Metadata::Slot_ProtocolName) |
+    slotMask(Message::Metadata::Slot_TransportMsg) |
+    slotMask(Message::Metadata::Slot_RawDataMsg) |
+    slotMask(Message::Metadata::Slot_ReceivedFrame) |
+    slotMask(Message::Metadata::Slot_ExtraInfoMsg) |
+    slotMask(Message::Metadata::Slot_ExtraInfo);
+
+bool hasOnlyReproducibleProperties(const Message& msg)
+{
+    auto& meta = msg.metadata();
+    return
+        ((meta.m_presence & ~ReproducibleMask) == 0U) &&
+        (msg.dynamicPropertyNames().isEmpty()) &&
+        (meta.m_extraInfo.isEmpty() == (!meta.m_extraInfoMsg));
+}
+
+void applyErases(
+    MsgStore::Positions& positions,
+    MsgStore::Positions::const_iterator logBeg,
+    MsgStore::Positions::const_iterator logEnd)
+{
+    // The logged positions are relative to the preceding erasures,
+    // map them to the positions recorded in the index.
+    MsgStore::Positions erased;
+    erased.reserve(static_cast<std::size_t>(std::distance(logBeg, logEnd)));
+    for (auto logIter = logBeg; logIter != logEnd; ++logIter) {
+        auto pos = *logIter;
+        auto iter = erased.begin();
+        for (; (iter != erased.end()) && (*iter <= pos); ++iter) {
+            ++pos;
+        }
+        erased.insert(iter, pos);
+    }
+
+    auto erasedIter = erased.cbegin();
+    std::uint32_t removedCount = 0U;
+    std::size_t outIdx = 0U;
+    for (auto pos : positions) {
+        while ((erasedIter != erased.cend()) && (*erasedIter < pos)) {
+            ++erasedIter;
+            ++removedCount;
+        }
+
+        if ((erasedIter != erased.cend()) && (*erasedIter == pos)) {
+            ++erasedIter;
+            ++removedCount;
+            continue;
+        }
+
+        positions[outIdx] = pos - removedCount;
+        ++outIdx;
+    }
+
+    positions.resize(outIdx);
+}
+
+}  // namespace
+
+MsgStore::MsgStore()
+  : m_typePositions(static_cast<std::size_t>(MsgType::NumOfValues))
+{
+}
+
+MsgStore::~MsgStore() noexcept = default;
+
+void MsgStore::setProtocol(ProtocolPtr protocol)
+{
+    if ((!m_segments.empty()) && (m_segments.back().m_protocol == protocol)) {
+        return;
+    }
+
+    MsgNumberType firstSeqNum = 0U;
+    if (!m_seqNums.empty()) {
+        firstSeqNum = m_seqNums.back() + 1;
+    }
+
+    if ((!m_segments.empty()) && (m_segments.back().m_firstSeqNum == firstSeqNum)) {
+        // No messages have been added with previous protocol
+        m_segments.pop_back();
+    }
+
+    ProtocolSegment segment;
+    segment.m_firstSeqNum = firstSeqNum;
+    segment.m_protocol = std::move(protocol);
+    m_segments.push_back(std::move(segment));
+}
+
+void MsgStore::reserve(std::size_t count)
+{
+    m_seqNums.reserve(count);
+    m_timestamps.reserve(count);
+    m_types.reserve(count);
+    m_ids.reserve(count);
+    m_frameChunks.reserve(count);
+    m_frameOffsets.reserve(count);
+    m_frameLengths.reserve(count);
+}
+
+void MsgStore::add(MessagePtr msg)
+{
+    assert(msg);
+    auto& meta = msg->metadata();
+    auto seqNum = meta.m_seqNumber;
+    assert(m_seqNums.empty() || (m_seqNums.back() < seqNum));
+    assert(size() < std::numeric_limits<std::uint32_t>::max());
+    assert(meta.m_type < m_typePositions.size());
+
+    auto pos = static_cast<std::uint32_t>(size());
+    auto idIdx = internId(msg->idAsString());
+    if ((!m_timestamps.empty()) && (meta.m_timestamp < m_timestamps.back())) {
+        m_chronological = false;
+    }
+
+    m_seqNums.push_back(seqNum);
+    m_timestamps.push_back(meta.m_timestamp);
+    m_types.push_back(static_cast<std::uint8_t>(meta.m_type));
+    m_ids.push_back(idIdx);
+    auto& typePositions = m_typePositions[meta.m_type];
+    syncPositions(typePositions);
+    typePositions.m_positions.push_back(pos);
+    auto& idPositions = m_idPositions[idIdx];
+    syncPositions(idPositions);
+    idPositions.m_positions.push_back(pos);
+
+    if (!storeFrame(*msg)) {
+        m_frameChunks.push_back(0U);
+        m_frameOffsets.push_back(0U);
+        m_frameLengths.push_back(0U);
+        m_pinned.insert(std::make_pair(seqNum, std::move(msg)));
+        return;
+    }
+
+    if (!meta.m_extraInfo.isEmpty()) {
+        m_extraInfos.insert(std::make_pair(seqNum, meta.m_extraInfo));
+    }
+
+    cacheLive(seqNum, msg);
+}
+
+bool MsgStore::erase(const Message& msg)
+{
+    auto idx = find(getSeqNumber(msg));
+    if (size() <= idx) {
+        return false;
+    }
+
+    if (MaxEraseLogSize <= m_eraseLog.size()) {
+        syncAllPositions();
+    }
+
+    m_eraseLog.push_back(static_cast<std::uint32_t>(idx));
+    m_timeOrderValid = false;
+
+    auto seqNum = m_seqNums[idx];
+    auto diff = static_cast<std::ptrdiff_t>(idx);
+    m_seqNums.erase(m_seqNums.begin() + diff);
+    m_timestamps.erase(m_timestamps.begin() + diff);
+    m_types.erase(m_types.begin() + diff);
+    m_ids.erase(m_ids.begin() + diff);
+    m_frameChunks.erase(m_frameChunks.begin() + diff);
+    m_frameOffsets.erase(m_frameOffsets.begin() + diff);
+    m_frameLengths.erase(m_frameLengths.begin() + diff);
+    m_extraInfos.erase(seqNum);
+    m_pinned.erase(seqNum);
+    m_live.erase(seqNum);
+    return true;
+}
+
+void MsgStore::clear()
+{
+    m_seqNums.clear();
+    m_timestamps.clear();
+    m_types.clear();
+    m_ids.clear();
+    m_frameChunks.clear();
+    m_frameOffsets.clear();
+    m_frameLengths.clear();
+    m_arena.clear();
+    m_extraInfos.clear();
+    m_pinned.clear();
+    m_live.clear();
+    m_livePurgeLimit = 0U;
+    m_idNames.clear();
+    m_idsMap.clear();
+    m_idPositions.clear();
+    for (auto& index : m_typePositions) {
+        index.m_positions.clear();
+        index.m_erasesApplied = 0U;
+    }
+    m_eraseLog.clear();
+    m_timeOrder.clear();
+    m_timeOrderValid = false;
+    m_chronological = true;
+
+    if (m_segments.empty()) {
+        return;
+    }
+
+    auto protocol = std::move(m_segments.back().m_protocol);
+    m_segments.clear();
+    setProtocol(std::move(protocol));
+}
+
+MessagePtr MsgStore::at(std::size_t idx) const
+{
+    assert(idx < size());
+    auto seqNum = m_seqNums[idx];
+    auto pinnedIter = m_pinned.find(seqNum);
+    if (pinnedIter != m_pinned.end()) {
+        return pinnedIter->second;
+    }
+
+    auto liveIter = m_live.find(seqNum);
+    if (liveIter != m_live.end()) {
+        auto msg = liveIter->second.lock();
+        if (msg) {
+            return msg;
+        }
+    }
+
+    auto msg = materialise(idx);
+    cacheLive(seqNum, msg);
+    return msg;
+}
+
+void MsgStore::getAll(std::vector<MessagePtr>& msgs) const
+{
+    std::vector<MessagePtr> result;
+    result.reserve(size());
+    auto msgsIter = msgs.begin();
+    for (auto idx = 0U; idx < size(); ++idx) {
+        auto seqNum = m_seqNums[idx];
+        while ((msgsIter != msgs.end()) &&
+               ((!(*msgsIter)) || (getSeqNumber(**msgsIter) < seqNum))) {
+            ++msgsIter;
+        }
+
+        if ((msgsIter != msgs.end()) && (getSeqNumber(**msgsIter) == seqNum)) {
+            result.push_back(std::move(*msgsIter));
+            ++msgsIter;
+            continue;
+        }
+
+        result.push_back(at(idx));
+    }
+
+    msgs.swap(result);
+}
+
+bool MsgStore::update(const MessagePtr& msg)
+{
+    assert(msg);
+    auto seqNum = getSeqNumber(*msg);
+    if (size() <= find(seqNum)) {
+        return false;
+    }
+
+    auto pinnedIter = m_pinned.find(seqNum);
+    if (pinnedIter != m_pinned.end()) {
+        return pinnedIter->second == msg;
+    }
+
+    auto liveIter = m_live.find(seqNum);
+    if ((liveIter == m_live.end()) || (liveIter->second.lock() != msg)) {
+        // Another object with the same sequence number
+        return false;
+    }
+
+    if (!hasOnlyReproducibleProperties(*msg)) {
+        m_pinned.insert(std::make_pair(seqNum, msg));
+        m_live.erase(liveIter);
+        return true;
+    }
+
+    auto& extraInfo = msg->metadata().m_extraInfo;
+    if (extraInfo.isEmpty()) {
+        m_extraInfos.erase(seqNum);
+    }
+    else {
+        m_extraInfos[seqNum] = extraInfo;
+    }
+    return true;
+}
+
+std::size_t MsgStore::find(MsgNumberType seqNum) const
+{
+    auto iter = std::lower_bound(m_seqNums.begin(), m_seqNums.end(), seqNum);
+    if ((iter == m_seqNums.end()) || (*iter != seqNum)) {
+        return size();
+    }
+
+    return static_cast<std::size_t>(std::distance(m_seqNums.begin(), iter));
+}
+
+const MsgStore::Positions& MsgStore::positionsOfType(MsgType type) const
+{
+    auto typeIdx = static_cast<std::size_t>(type);
+    if (m_typePositions.size() <= typeIdx) {
+        static const Positions Empty;
+        return Empty;
+    }
+
+    return syncPositions(m_typePositions[typeIdx]);
+}
+
+const MsgStore::Positions& MsgStore::positionsOfId(const QString& id) const
+{
+    auto iter = m_idsMap.find(id);
+    if (iter == m_idsMap.end()) {
+        static const Positions Empty;
+        return Empty;
+    }
+
+    return syncPositions(m_idPositions[iter->second]);
+}
+
+MsgStore::Positions MsgStore::positionsInTimeRange(
+    TimestampType from,
+    TimestampType to) const
+{
+    Positions result;
+    if (to <= from) {
+        return result;
+    }
+
+    if (m_chronological) {
+        auto fromIter = std::lower_bound(m_timestamps.begin(), m_timestamps.end(), from);
+        auto toIter = std::lower_bound(fromIter, m_timestamps.end(), to);
+        auto fromPos = static_cast<std::uint32_t>(std::distance(m_timestamps.begin(), fromIter));
+        auto toPos = static_cast<std::uint32_t>(std::distance(m_timestamps.begin(), toIter));
+        result.reserve(toPos - fromPos);
+        for (auto pos = fromPos; pos < toPos; ++pos) {
+            result.push_back(pos);
+        }
+        return result;
+    }
+
+    updateTimeOrder();
+    auto compFunc =
+        [this](std::uint32_t pos, TimestampType val) -> bool
+        {
+            return m_timestamps[pos] < val;
+        };
+
+    auto fromIter = std::lower_bound(m_timeOrder.begin(), m_timeOrder.end(), from, compFunc);
+    auto toIter = std::lower_bound(fromIter, m_timeOrder.end(), to, compFunc);
+    result.assign(fromIter, toIter);
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+MsgStore::MsgNumberType MsgStore::getSeqNumber(const Message& msg)
+{
+    return SeqNumber().getFrom(msg);
+}
+
+void MsgStore::setSeqNumber(MsgNumberType seqNum, Message& msg)
+{
+    SeqNumber().setTo(seqNum, msg);
+}
+
+std::uint32_t MsgStore::internId(const QString& id)
+{
+    auto iter = m_idsMap.find(id);
+    if (iter != m_idsMap.end()) {
+        return iter->second;
+    }
+
+    auto idx = static_cast<std::uint32_t>(m_idNames.size());
+    m_idNames.push_back(id);
+    m_idPositions.emplace_back();
+    m_idPositions.back().m_erasesApplied = m_eraseLog.size();
+    m_idsMap.insert(std::make_pair(id, idx));
+    return idx;
+}
+
+bool MsgStore::storeFrame(const Message& msg)
+{
+    auto& meta = msg.metadata();
+    if ((!hasOnlyReproducibleProperties(msg)) ||
+        (static_cast<MsgType>(meta.m_type) != MsgType::Received) ||
+        (!meta.m_receivedFrame)) {
+        return false;
+    }
+
+    auto* segment = lastSegment();
+    if ((segment == nullptr) || (meta.m_protocolName != segment->m_protocol->name())) {
+        return false;
+    }
+
+    auto& frame = *meta.m_receivedFrame;
+    if (!segment->m_decodeChecked) {
+        segment->m_decodeChecked = true;
+        DataInfo dataInfo;
+        dataInfo.m_data.assign(frame.data(), frame.data() + frame.size());
+        segment->m_decodeSupported = static_cast<bool>(segment->m_protocol->decodeFrame(dataInfo));
+    }
+
+    if ((!segment->m_decodeSupported) ||
+        (std::numeric_limits<std::uint32_t>::max() < frame.size())) {
+        return false;
+    }
+
+    storeFrameBytes(frame.data(), frame.size());
+    return true;
+}
+
+void MsgStore::storeFrameBytes(const std::uint8_t* data, std::size_t len)
+{
+    if (m_arena.empty() ||
+        ((m_arena.back().capacity() - m_arena.back().size()) < len)) {
+        m_arena.emplace_back();
+        m_arena.back().reserve(std::max(ArenaChunkSize, len));
+    }
+
+    auto& chunk = m_arena.back();
+    m_frameChunks.push_back(static_cast<std::uint32_t>(m_arena.size() - 1U));
+    m_frameOffsets.push_back(static_cast<std::uint32_t>(chunk.size()));
+    m_frameLengths.push_back(static_cast<std::uint32_t>(len));
+    chunk.insert(chunk.end(), data, data + len);
+}
+
+MsgStore::ProtocolSegment* MsgStore::lastSegment()
+{
+    if (m_segments.empty() || (!m_segments.back().m_protocol)) {
+        return nullptr;
+    }
+
+    return &m_segments.back();
+}
+
+const MsgStore::ProtocolSegment* MsgStore::segmentOf(MsgNumberType seqNum) const
+{
+    auto iter =
+        std::upper_bound(
+            m_segments.begin(), m_segments.end(), seqNum,
+            [](MsgNumberType val, const ProtocolSegment& segment) -> bool
+            {
+                return val < segment.m_firstSeqNum;
+            });
+
+    if (iter == m_segments.begin()) {
+        return nullptr;
+    }
+
+    return &(*(iter - 1));
+}
+
+MessagePtr MsgStore::materialise(std::size_t idx) const
+{
+    auto seqNum = m_seqNums[idx];
+    auto* segment = segmentOf(seqNum);
+    if ((segment == nullptr) || (!segment->m_protocol)) {
+        assert(!"Protocol of the stored frame is unknown");
+        return MessagePtr();
+    }
+
+    auto& chunk = m_arena[m_frameChunks[idx]];
+    auto* frameBeg = chunk.data() + m_frameOffsets[idx];
+
+    DataInfo dataInfo;
+    dataInfo.m_data.assign(frameBeg, frameBeg + m_frameLengths[idx]);
+    auto extraIter = m_extraInfos.find(seqNum);
+    if (extraIter != m_extraInfos.end()) {
+        dataInfo.m_extraProperties = extraIter->second;
+    }
+
+    auto msg = segment->m_protocol->decodeFrame(dataInfo);
+    if (!msg) {
+        assert(!"Failed to re-create stored message");
+        return msg;
+    }
+
+    property::message::Type().setTo(typeAt(idx), *msg);
+    property::message::Timestamp().setTo(m_timestamps[idx], *msg);
+    setSeqNumber(seqNum, *msg);
+    return msg;
+}
+
+void MsgStore::updateTimeOrder() const
+{
+    if (!m_timeOrderValid) {
+        m_timeOrder.clear();
+    }
+
+    // The positions appended since the last update are sorted on their
+    // own and merged with the already ordered ones.
+    auto sortedCount = m_timeOrder.size();
+    if (size() <= sortedCount) {
+        m_timeOrderValid = true;
+        return;
+    }
+
+    m_timeOrder.resize(size());
+    for (auto idx = sortedCount; idx < m_timeOrder.size(); ++idx) {
+        m_timeOrder[idx] = static_cast<std::uint32_t>(idx);
+    }
+
+    auto compFunc =
+        [this](std::uint32_t first, std::uint32_t second) -> bool
+        {
+            return m_timestamps[first] < m_timestamps[second];
+        };
+
+    auto midIter = m_timeOrder.begin() + static_cast<std::ptrdiff_t>(sortedCount);
+    std::stable_sort(midIter, m_timeOrder.end(), compFunc);
+    std::inplace_merge(m_timeOrder.begin(), midIter, m_timeOrder.end(), compFunc);
+    m_timeOrderValid = true;
+}
+
+const MsgStore::Positions& MsgStore::syncPositions(PositionsIndex& index) const
+{
+    assert(index.m_erasesApplied <= m_eraseLog.size());
+    if (index.m_erasesApplied < m_eraseLog.size()) {
+        applyErases(
+            index.m_positions,
+            m_eraseLog.cbegin() + static_cast<std::ptrdiff_t>(index.m_erasesApplied),
+            m_eraseLog.cend());
+        index.m_erasesApplied = m_eraseLog.size();
+    }
+
+    return index.m_positions;
+}
+
+void MsgStore::syncAllPositions()
+{
+    for (auto* indices : {&m_typePositions, &m_idPositions}) {
+        for (auto& index : *indices) {
+            syncPositions(index);
+            index.m_erasesApplied = 0U;
+        }
+    }
+
+    m_eraseLog.clear();
+}
+
+void MsgStore::cacheLive(MsgNumberType seqNum, const MessagePtr& msg) const
+{
+    if (!msg) {
+        return;
+    }
+
+    m_live[seqNum] = msg;
+    if (m_live.size() <= m_livePurgeLimit) {
+        return;
+    }
+
+    for (auto iter = m_live.begin(); iter != m_live.end();) {
+        if (iter->second.expired()) {
+            iter = m_live.erase(iter);
+            continue;
+        }
+
+        ++iter;
+    }
+
+    m_livePurgeLimit = std::max(MinLivePurgeLimit, m_live.size() * 2);
+}
+
+}  // namespace comms_champion
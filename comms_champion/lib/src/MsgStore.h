@@ -0,0 +1,202 @@
+//
+// Copyright 2014 - 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QString>
+#include <QtCore/QVariantMap>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/Message.h"
+#include "comms_champion/Protocol.h"
+
+namespace comms_champion
+{
+
+/// @brief Storage of the recorded messages.
+/// @details Keeps sequence numbers, timestamps, types, IDs and raw frame
+///     bytes of the received messages in compact columns and append-only
+///     arenas. The message objects are re-created from the frame bytes
+///     using Protocol::decodeFrame() on request. While the object returned
+///     previously is still referenced elsewhere, the same object is returned.
+///     The messages that cannot be re-created (sent or loaded ones, the
+///     protocol doesn't support decoding of its frames on their own, such as
+///     ones with batched or delta encoded messages, or the message carries
+///     properties not kept in the columns) are stored as is.
+///     Also maintains secondary indexes of message positions per type and
+///     per ID, as well as (when the messages are not added in the
+///     chronological order) positions sorted by timestamp, to which
+///     the newly added messages are merged on the next time range query.
+///     The per type and per ID positions are updated after erasure of
+///     a message when they are accessed next time.
+class MsgStore
+{
+public:
+    typedef unsigned long long MsgNumberType;
+    typedef unsigned long long TimestampType;
+    typedef Message::Type MsgType;
+    typedef std::vector<std::uint32_t> Positions;
+
+    MsgStore();
+    ~MsgStore() noexcept;
+
+    void setProtocol(ProtocolPtr protocol);
+
+    void reserve(std::size_t count);
+    void add(MessagePtr msg);
+    bool erase(const Message& msg);
+    void clear();
+
+    /// @brief Record properties assigned to the stored message after
+    ///     it has been added.
+    /// @details The message is kept as is from now on if these properties
+    ///     cannot be re-created from the stored frame.
+    /// @return false if the message object is not the stored one.
+    bool update(const MessagePtr& msg);
+
+    std::size_t size() const
+    {
+        return m_seqNums.size();
+    }
+
+    bool empty() const
+    {
+        return m_seqNums.empty();
+    }
+
+    MessagePtr at(std::size_t idx) const;
+
+    /// @brief Update the list of all the stored messages.
+    /// @details The provided list is expected to be ordered by the
+    ///     sequence numbers, such as one filled by the previous invocation.
+    ///     The erased messages are removed from it, the ones still in
+    ///     the list are kept and only the missing ones are re-created.
+    void getAll(std::vector<MessagePtr>& msgs) const;
+
+    MsgNumberType seqNumberAt(std::size_t idx) const
+    {
+        return m_seqNums[idx];
+    }
+
+    TimestampType timestampAt(std::size_t idx) const
+    {
+        return m_timestamps[idx];
+    }
+
+    MsgType typeAt(std::size_t idx) const
+    {
+        return static_cast<MsgType>(m_types[idx]);
+    }
+
+    const QString& idAt(std::size_t idx) const
+    {
+        return m_idNames[m_ids[idx]];
+    }
+
+    /// @brief Find position of the message with provided sequence number.
+    /// @return Position of the message, size() if not found.
+    std::size_t find(MsgNumberType seqNum) const;
+
+    /// @brief Get positions of the messages of provided type in ascending order.
+    const Positions& positionsOfType(MsgType type) const;
+
+    /// @brief Get positions of the messages with provided ID in ascending order.
+    const Positions& positionsOfId(const QString& id) const;
+
+    /// @brief Get positions of the messages with timestamps in range [from, to)
+    ///     in ascending order.
+    Positions positionsInTimeRange(TimestampType from, TimestampType to) const;
+
+    static MsgNumberType getSeqNumber(const Message& msg);
+    static void setSeqNumber(MsgNumberType seqNum, Message& msg);
+
+private:
+    typedef Message::DataSeq DataSeq;
+
+    struct PositionsIndex
+    {
+        Positions m_positions;
+        std::size_t m_erasesApplied = 0U;
+    };
+
+    struct ProtocolSegment
+    {
+        MsgNumberType m_firstSeqNum = 0U;
+        ProtocolPtr m_protocol;
+        bool m_decodeChecked = false;
+        bool m_decodeSupported = false;
+    };
+
+    std::uint32_t internId(const QString& id);
+    bool storeFrame(const Message& msg);
+    void storeFrameBytes(const std::uint8_t* data, std::size_t len);
+    ProtocolSegment* lastSegment();
+    const ProtocolSegment* segmentOf(MsgNumberType seqNum) const;
+    MessagePtr materialise(std::size_t idx) const;
+    void updateTimeOrder() const;
+    const Positions& syncPositions(PositionsIndex& index) const;
+    void syncAllPositions();
+    void cacheLive(MsgNumberType seqNum, const MessagePtr& msg) const;
+
+    // Columns
+    std::vector<MsgNumberType> m_seqNums;
+    std::vector<TimestampType> m_timestamps;
+    std::vector<std::uint8_t> m_types;
+    std::vector<std::uint32_t> m_ids;
+    std::vector<std::uint32_t> m_frameChunks;
+    std::vector<std::uint32_t> m_frameOffsets;
+    std::vector<std::uint32_t> m_frameLengths;
+
+    // Append-only frame bytes storage, chunks are never reallocated
+    std::vector<DataSeq> m_arena;
+
+    // Interned message IDs
+    std::vector<QString> m_idNames;
+    std::map<QString, std::uint32_t> m_idsMap;
+
+    // Sparse data, keyed by sequence number
+    std::map<MsgNumberType, QVariantMap> m_extraInfos;
+    std::map<MsgNumberType, MessagePtr> m_pinned;
+    mutable std::unordered_map<MsgNumberType, std::weak_ptr<Message> > m_live;
+    mutable std::size_t m_livePurgeLimit = 0U;
+
+    std::vector<ProtocolSegment> m_segments;
+
+    // Secondary indexes, positions of the erased messages are logged
+    // and applied to each index on its next access
+    mutable std::vector<PositionsIndex> m_typePositions;
+    mutable std::vector<PositionsIndex> m_idPositions;
+    Positions m_eraseLog;
+    // Covers positions up to its size, the ones appended later are
+    // merged in by updateTimeOrder()
+    mutable Positions m_timeOrder;
+    mutable bool m_timeOrderValid = false;
+    bool m_chronological = true;
+};
+
+}  // namespace comms_champion
@@ -44,6 +44,11 @@ Protocol::MessagesList Protocol::read(
     return readImpl(dataInfo, final);
 }
 
+MessagePtr Protocol::decodeFrame(const DataInfo& dataInfo)
+{
+    return decodeFrameImpl(dataInfo);
+}
+
 DataInfoPtr Protocol::write(Message& msg)
 {
 
@@ -169,6 +174,12 @@ MessagePtr Protocol::createInvalidMessage(const MsgDataSeq& data)
     return invalidMsg;
 }
 
+MessagePtr Protocol::decodeFrameImpl(const DataInfo& dataInfo)
+{
+    static_cast<void>(dataInfo);
+    return MessagePtr();
+}
+
 void Protocol::setNameToMessageProperties(Message& msg)
 {
     property::message::ProtocolName().setTo(name(), msg);
@@ -184,6 +195,11 @@ void Protocol::setRawDataToMessageProperties(MessagePtr rawDataMsg, Message& msg
     property::message::RawDataMsg().setTo(std::move(rawDataMsg), msg);
 }
 
+void Protocol::setReceivedFrameToMessageProperties(ReceivedFramePtr frame, Message& msg)
+{
+    property::message::ReceivedFrame().setTo(std::move(frame), msg);
+}
+
 void Protocol::setExtraInfoMsgToMessageProperties(MessagePtr extraInfoMsg, Message& msg)
 {
     property::message::ExtraInfoMsg().setTo(std::move(extraInfoMsg), msg);
@@ -0,0 +1,69 @@
+//
+// Copyright 2014 - 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "comms_champion/ReceivedFrame.h"
+
+#include <cassert>
+
+namespace comms_champion
+{
+
+ReceivedFrame::ReceivedFrame(DataSeqPtr data, std::size_t offset, std::size_t length)
+  : m_data(std::move(data)),
+    m_offset(offset),
+    m_length(length)
+{
+    assert(m_data);
+    assert((m_offset + m_length) <= m_data->size());
+}
+
+ReceivedFrame::~ReceivedFrame() noexcept = default;
+
+const std::uint8_t* ReceivedFrame::data() const
+{
+    if (m_length == 0U) {
+        return nullptr;
+    }
+
+    return &(*m_data)[m_offset];
+}
+
+std::size_t ReceivedFrame::size() const
+{
+    return m_length;
+}
+
+MessagePtr ReceivedFrame::transportMsg() const
+{
+    if (!m_transportMsg) {
+        m_transportMsg = createTransportMsgImpl();
+    }
+
+    return m_transportMsg;
+}
+
+MessagePtr ReceivedFrame::rawDataMsg() const
+{
+    if (!m_rawDataMsg) {
+        m_rawDataMsg = createRawDataMsgImpl();
+    }
+
+    return m_rawDataMsg;
+}
+
+} // namespace comms_champion
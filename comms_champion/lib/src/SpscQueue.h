@@ -0,0 +1,88 @@
+//
+// Copyright 2014 - 2019 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+namespace comms_champion
+{
+
+/// @brief Unbounded lock-free queue of single producer and single consumer.
+/// @details The push() is expected to be invoked by one thread only,
+///     while pop() by another.
+template <typename T>
+class SpscQueue
+{
+public:
+    SpscQueue()
+      : m_head(new Node()),
+        m_tail(m_head)
+    {
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    ~SpscQueue() noexcept
+    {
+        while (m_head != nullptr) {
+            auto* next = m_head->m_next.load(std::memory_order_relaxed);
+            delete m_head;
+            m_head = next;
+        }
+    }
+
+    void push(T&& value)
+    {
+        auto* node = new Node();
+        node->m_value = std::move(value);
+        m_tail->m_next.store(node, std::memory_order_release);
+        m_tail = node;
+    }
+
+    bool pop(T& value)
+    {
+        auto* next = m_head->m_next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            return false;
+        }
+
+        value = std::move(next->m_value);
+        next->m_value = T();
+        delete m_head;
+        m_head = next;
+        return true;
+    }
+
+private:
+    struct Node
+    {
+        std::atomic<Node*> m_next{nullptr};
+        T m_value;
+    };
+
+    // Accessed by consumer only, points to already consumed node
+    Node* m_head;
+
+    // Accessed by producer only
+    Node* m_tail;
+};
+
+}  // namespace comms_champion
@@ -41,6 +41,9 @@ const QByteArray TransportMsg::PropName = TransportMsg::Name.toUtf8();
 const QString RawDataMsg::Name("cc.msg_raw_data");
 const QByteArray RawDataMsg::PropName = RawDataMsg::Name.toUtf8();
 
+const QString ReceivedFrame::Name("cc.msg_received_frame");
+const QByteArray ReceivedFrame::PropName = ReceivedFrame::Name.toUtf8();
+
 const QString ExtraInfoMsg::Name("cc.msg_extra_info");
 const QByteArray ExtraInfoMsg::PropName = ExtraInfoMsg::Name.toUtf8();
 
@@ -71,6 +74,36 @@ const QByteArray ScrollPos::PropName = ScrollPos::Name.toUtf8();
 const QString Comment::Name("cc.msg_comment");
 const QByteArray Comment::PropName = Comment::Name.toUtf8();
 
+TransportMsg::ValueType TransportMsg::getFrom(const Message& msg, const ValueType& defaultVal) const
+{
+    auto result = Base::getFrom(msg, defaultVal);
+    if (result) {
+        return result;
+    }
+
+    auto frame = ReceivedFrame().getFrom(msg);
+    if (!frame) {
+        return result;
+    }
+
+    return frame->transportMsg();
+}
+
+RawDataMsg::ValueType RawDataMsg::getFrom(const Message& msg, const ValueType& defaultVal) const
+{
+    auto result = Base::getFrom(msg, defaultVal);
+    if (result) {
+        return result;
+    }
+
+    auto frame = ReceivedFrame().getFrom(msg);
+    if (!frame) {
+        return result;
+    }
+
+    return frame->rawDataMsg();
+}
+
 }  // namespace message
 
 }  // namespace property